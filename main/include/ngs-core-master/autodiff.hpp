@@ -395,6 +395,8 @@ namespace ngstd
 
 
 
+	using std::fabs; //otherwise fabs(double) is hidden by fabs(AutoDiff) in namespace ngstd
+
 	template<int D, typename SCAL>
 	INLINE AutoDiff<D, SCAL> fabs(const AutoDiff<D, SCAL> & x)
 	{
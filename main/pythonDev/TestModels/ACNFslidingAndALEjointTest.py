@@ -224,7 +224,7 @@ exu.Print("select cable coordinate", nc)
 sol = mbs.systemData.GetODE2Coordinates(); 
 uStatic = sol[nc]; #y-displacement of first node of four bar mechanism
 exu.Print('static solution of cable1 =',uStatic)
-exudynTestGlobals.testError = uStatic - (-2.197321886974786) #2020-03-05(corrected Cable2DshapeMarker): -2.197321886974786 #2019-12-26:  2.1973218859908146
+exudynTestGlobals.testError = uStatic - (-2.197321886923391) #2026-10-16: changed from -2.1973218869942377 due to LU factorization in dense solver (instead of inverse); 2026-10-16: changed from -2.197321886974786 due to autodiff jacobian of coupled ANCFCable2D elements (ALE cable still numerical); 2020-03-05(corrected Cable2DshapeMarker): -2.197321886974786 #2019-12-26:  2.1973218859908146
 
 #++++++++++++++++++++++++++++++++++++++++
 #store solution for next computation
@@ -280,7 +280,7 @@ sol = mbs.systemData.GetODE2Coordinates();
 uDynamic = sol[nc]; #y-displacement of first node of four bar mechanism
 exu.Print('dynamic solution of cable1 =',uDynamic)
 
-exudynTestGlobals.testError += uDynamic - (-2.2290811574753953) #2020-03-05(corrected Cable2DshapeMarker): -2.2290811574753953 #2019-12-26: -2.2290811558815617; 2019-12-18: -2.229126333291627
+exudynTestGlobals.testError += uDynamic - (-2.2290811573575238) #2026-10-16: changed from -2.2290811592575728 due to LU factorization in dense solver (instead of inverse); 2026-10-16: changed from -2.2290811574753953 due to autodiff jacobian of coupled ANCFCable2D elements (ALE cable still numerical); 2020-03-05(corrected Cable2DshapeMarker): -2.2290811574753953 #2019-12-26: -2.2290811558815617; 2019-12-18: -2.229126333291627
 
 
 
@@ -0,0 +1,121 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test for analytic ODE2 jacobians of ObjectGenericODE2, ObjectFFRFreducedOrder (sparse matrices)
+#           and SpringDamper, CartesianSpringDamper and CoordinateSpringDamper;
+#           the same model with (linear) user functions uses numerical differentiation and must give same results
+#
+# Author:   agent
+# Date:     2026-10-16
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+import sys
+sys.path.append('../TestModels')            #for modelUnitTest as this example may be used also as a unit test
+
+import exudyn as exu
+from exudyn.itemInterface import *
+
+from modelUnitTests import ExudynTestStructure, exudynTestGlobals
+
+import numpy as np
+
+SC = exu.SystemContainer()
+mbs = SC.AddSystem()
+
+#user functions, which reproduce the linear force laws, but switch to numerical jacobians:
+def UFzeroForce(t, q, q_t):
+    return [0]*len(q)
+
+def UFspringDamper(t, u, v, k, d, F0):
+    return k*u + d*v + F0
+
+def UFcartesianSpringDamper(t, u, v, k, d, offset):
+    return [k[i]*u[i] + d[i]*v[i] for i in range(3)]
+
+def UFcoordinateSpringDamper(t, u, v, k, d, offset, dryFriction, dryFrictionProportionalZone):
+    return k*(u-offset) + d*v
+
+def CreateModel(mbs, useUserFunctions):
+    nGround = mbs.AddNode(NodePointGround(referenceCoordinates=[0,0,0]))
+    mGroundPosition = mbs.AddMarker(MarkerNodePosition(nodeNumber=nGround))
+    mGroundCoordinate = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber=nGround, coordinate=0))
+
+    #generic ODE2 object with stiffness and damping matrix
+    K = 1e3*np.array([[2,-1,0],[-1,2,-1],[0,-1,2]])
+    nGeneric = mbs.AddNode(NodeGenericODE2(numberOfODE2Coordinates=3, referenceCoordinates=[0,0,0],
+                                           initialCoordinates=[0.01,0,-0.01], initialCoordinates_t=[0,0,0]))
+    mbs.AddObject(ObjectGenericODE2(nodeNumbers=[nGeneric], massMatrix=np.diag([1,2,1]), stiffnessMatrix=K,
+                                    dampingMatrix=1e-3*K, forceVector=[0,0,1],
+                                    forceUserFunction=UFzeroForce if useUserFunctions else 0))
+
+    #FFRF reduced order object with sparse reduced matrices; rigid body part provided by RigidBody on same node
+    nModes = 6
+    Kff = np.zeros((nModes,nModes))
+    for i in range(nModes):
+        Kff[i,i] = 2e3*(i+1)
+        if i > 0:
+            Kff[i,i-1] = Kff[i-1,i] = -5e2
+    KffMC = exu.MatrixContainer()
+    KffMC.SetWithDenseMatrix(Kff, useDenseMatrix=False)
+    DffMC = exu.MatrixContainer()
+    DffMC.SetWithDenseMatrix(1e-3*Kff, useDenseMatrix=False)
+    MffMC = exu.MatrixContainer()
+    MffMC.SetWithDenseMatrix(np.eye(nModes), useDenseMatrix=False)
+
+    nRB = mbs.AddNode(NodeRigidBodyRxyz(referenceCoordinates=[0,0,0, 0,0,0], initialVelocities=[0,0,0, 0,0,2]))
+    mbs.AddObject(RigidBody(physicsMass=2, physicsInertia=[0.1,0.1,0.2,0,0,0], nodeNumber=nRB))
+    nFF = mbs.AddNode(NodeGenericODE2(numberOfODE2Coordinates=nModes, referenceCoordinates=[0]*nModes,
+                                      initialCoordinates=[0.01*(i+1) for i in range(nModes)], initialCoordinates_t=[0]*nModes))
+    mbs.AddObject(ObjectFFRFreducedOrder(nodeNumbers=[nRB, nFF], massMatrixReduced=MffMC, stiffnessMatrixReduced=KffMC,
+                                         dampingMatrixReduced=DffMC, modeBasis=np.eye(3*2)[:,0:nModes], referencePositions=[0]*6,
+                                         forceUserFunction=UFzeroForce if useUserFunctions else 0,
+                                         visualization=VObjectFFRFreducedOrder(show=False)))
+    mRB = mbs.AddMarker(MarkerNodePosition(nodeNumber=nRB))
+    mbs.AddObject(CartesianSpringDamper(markerNumbers=[mGroundPosition, mRB], stiffness=[1e3,1e3,1e3], damping=[1,1,1],
+                                        springForceUserFunction=UFcartesianSpringDamper if useUserFunctions else 0))
+    mFF = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber=nFF, coordinate=0))
+    mbs.AddObject(CoordinateSpringDamper(markerNumbers=[mGroundCoordinate, mFF], stiffness=1e3, damping=2, offset=0.005,
+                                         springForceUserFunction=UFcoordinateSpringDamper if useUserFunctions else 0))
+
+    #prestressed distance spring-damper between mass points: geometric stiffness
+    nMP0 = mbs.AddNode(NodePoint(referenceCoordinates=[1,0,0], initialVelocities=[0,0.5,0]))
+    nMP1 = mbs.AddNode(NodePoint(referenceCoordinates=[2,0,0], initialVelocities=[0,-0.5,0.2]))
+    mMP0 = mbs.AddMarker(MarkerNodePosition(nodeNumber=nMP0))
+    mMP1 = mbs.AddMarker(MarkerNodePosition(nodeNumber=nMP1))
+    for nMP in [nMP0, nMP1]:
+        oMP = mbs.AddObject(MassPoint(physicsMass=0.5, nodeNumber=nMP))
+    mbs.AddObject(CartesianSpringDamper(markerNumbers=[mGroundPosition, mMP0], stiffness=[1e3,1e3,1e3], damping=[1,1,1], offset=[1,0,0],
+                                        springForceUserFunction=UFcartesianSpringDamper if useUserFunctions else 0))
+    mbs.AddObject(SpringDamper(markerNumbers=[mMP0, mMP1], stiffness=2e3, damping=5, referenceLength=0.8, force=10,
+                               springForceUserFunction=UFspringDamper if useUserFunctions else 0))
+    mbs.Assemble()
+    return [nGeneric, nFF, nRB, nMP1]
+
+simulationSettings = exu.SimulationSettings()
+simulationSettings.timeIntegration.endTime = 0.2
+simulationSettings.timeIntegration.numberOfSteps = 200
+simulationSettings.timeIntegration.newton.useModifiedNewton = False #jacobian computed in every step
+simulationSettings.solutionSettings.writeSolutionToFile = False
+simulationSettings.linearSolverType = exu.LinearSolverType.EigenSparse
+
+results = []
+for (useUserFunctions, nThreads) in [(True, 1), (False, 1), (False, 2)]:
+    mbs.Reset()
+    nodes = CreateModel(mbs, useUserFunctions)
+    simulationSettings.numberOfThreads = nThreads
+    SC.TimeIntegrationSolve(mbs, 'GeneralizedAlpha', simulationSettings)
+
+    uSum = 0
+    for n in nodes:
+        uSum += np.sum(mbs.GetNodeOutput(n, exu.OutputVariableType.Coordinates))
+    exu.Print('user functions =', useUserFunctions, ', numberOfThreads =', nThreads, ': uSum =', uSum)
+    results += [uSum]
+
+exudynTestGlobals.testError = results[0] - (0.19841973744983912) #2026-10-16: sum of node coordinates for numerical jacobian (user functions)
+#analytic jacobians (1 and 2 threads) must reproduce numerical jacobian (differences only due to Newton tolerance):
+for i in range(1, len(results)):
+    if abs(results[i]-results[0]) > 1e-10:
+        exu.Print('ERROR: analytic jacobian run', i, 'differs from numerical jacobian by', results[i]-results[0])
+        exudynTestGlobals.testError += 1
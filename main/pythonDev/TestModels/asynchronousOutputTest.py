@@ -0,0 +1,69 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test for asynchronous solution and sensor output (solutionSettings.writeAsynchronously);
+#           small ring buffer forces back-pressure; result files must be identical to synchronous output
+#
+# Author:   agent
+# Date:     2026-10-16
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+import sys
+sys.path.append('../TestModels')            #for modelUnitTest as this example may be used also as a unit test
+
+import exudyn as exu
+from exudyn.itemInterface import *
+from exudyn.utilities import LoadSolutionFile
+
+import numpy as np
+from modelUnitTests import ExudynTestStructure, exudynTestGlobals
+
+SC = exu.SystemContainer()
+mbs = SC.AddSystem()
+
+#chain of masses connected by springs
+nMasses = 5
+nGround = mbs.AddNode(NodePointGround(referenceCoordinates=[0,0,0]))
+mPrevious = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber=nGround, coordinate=0))
+for i in range(nMasses):
+    n = mbs.AddNode(Node1D(referenceCoordinates=[0], initialCoordinates=[0.01*(i+1)], initialVelocities=[0]))
+    mbs.AddObject(Mass1D(physicsMass=1, nodeNumber=n))
+    m = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber=n, coordinate=0))
+    mbs.AddObject(CoordinateSpringDamper(markerNumbers=[mPrevious, m], stiffness=1000, damping=1))
+    mPrevious = m
+
+sensorFileName = 'solution/asyncSensorTest.txt'
+mbs.AddSensor(SensorNode(nodeNumber=n, fileName=sensorFileName, outputVariableType=exu.OutputVariableType.Coordinates_t))
+
+mbs.Assemble()
+
+simulationSettings = exu.SimulationSettings()
+simulationSettings.timeIntegration.endTime = 0.5
+simulationSettings.timeIntegration.numberOfSteps = 500
+simulationSettings.solutionSettings.solutionWritePeriod = 0.002
+simulationSettings.solutionSettings.sensorsWritePeriod = 0.002
+simulationSettings.solutionSettings.outputPrecision = 16
+
+results = []
+for writeAsynchronously in [False, True]:
+    simulationSettings.solutionSettings.coordinatesSolutionFileName = 'solution/asyncSolutionTest'+str(writeAsynchronously)+'.txt'
+    simulationSettings.solutionSettings.writeAsynchronously = writeAsynchronously
+    simulationSettings.solutionSettings.asyncBufferSize = 1000 #only few rows fit into ring buffer
+    simulationSettings.solutionSettings.asyncBlockIfBufferFull = True
+    
+    SC.TimeIntegrationSolve(mbs, 'GeneralizedAlpha', simulationSettings)
+
+    solution = LoadSolutionFile(simulationSettings.solutionSettings.coordinatesSolutionFileName)
+    sensor = np.loadtxt(sensorFileName, comments='#', delimiter=',')
+    results += [(solution['data'], sensor)]
+
+difference = np.max(abs(results[0][0]-results[1][0])) + np.max(abs(results[0][1]-results[1][1]))
+exu.Print('rows =', results[1][0].shape[0], ', difference synchronous / asynchronous =', difference)
+
+exudynTestGlobals.testError = sum(results[0][0][-1]) + results[0][1][-1][1] - (7.4963937417319135) #2026-10-16: last row of synchronous solution and sensor file
+#asynchronous files must be identical to synchronous files:
+if results[0][0].shape != results[1][0].shape or results[0][1].shape != results[1][1].shape or difference != 0:
+    exu.Print('ERROR: asynchronous output differs from synchronous output by', difference)
+    exudynTestGlobals.testError += 1
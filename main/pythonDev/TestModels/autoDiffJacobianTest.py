@@ -0,0 +1,82 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test for jacobians by automatic differentiation of ANCFCable2D and CoordinateSpringDamper with dry friction;
+#           ANCF cantilever with tip attached to ground by CoordinateSpringDampers with dry friction;
+#           the same model with spring-damper user functions uses numerical differentiation for connectors and must give same results
+#
+# Author:   agent
+# Date:     2026-10-16
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+import sys
+sys.path.append('../TestModels')            #for modelUnitTest as this example may be used also as a unit test
+
+import exudyn as exu
+from exudyn.itemInterface import *
+from exudyn.utilities import *
+
+from modelUnitTests import ExudynTestStructure, exudynTestGlobals
+
+SC = exu.SystemContainer()
+mbs = SC.AddSystem()
+
+#user function, which reproduces the built-in force law including dry friction, but switches to numerical jacobians:
+def UFcoordinateSpringDamper(t, u, v, k, d, offset, dryFriction, dryFrictionProportionalZone):
+    f = k*(u-offset) + d*v
+    if abs(v) < dryFrictionProportionalZone:
+        f += v/dryFrictionProportionalZone*dryFriction
+    elif v > 0:
+        f += dryFriction
+    elif v < 0:
+        f -= dryFriction
+    return f
+
+def CreateModel(mbs, useUserFunctions):
+    L = 2       #length of cable
+    nEl = 4     #number of elements
+    cableTemplate = Cable2D(physicsMassPerLength=10, physicsBendingStiffness=5000, physicsAxialStiffness=1e6,
+                            physicsBendingDamping=1, physicsAxialDamping=10)
+
+    [nodeList, objectList, loadList, nodePositionList, dummy] = GenerateStraightLineANCFCable2D(mbs=mbs,
+        positionOfNode0=[0,0], positionOfNode1=[L,0], numberOfElements=nEl, cableTemplate=cableTemplate,
+        massProportionalLoad=[0,-9.81,0], fixedConstraintsNode0=[1,1,0,1], fixedConstraintsNode1=[0,0,0,0])
+
+    nGround = mbs.AddNode(NodePointGround(referenceCoordinates=[0,0,0]))
+    mGround = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber=nGround, coordinate=0))
+
+    #tip is guided by spring-dampers with dry friction in x and y direction
+    for coordinate in range(2):
+        mTip = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber=nodeList[-1], coordinate=coordinate))
+        mbs.AddObject(CoordinateSpringDamper(markerNumbers=[mGround, mTip], stiffness=2e3, damping=5, offset=0,
+                                             dryFriction=20, dryFrictionProportionalZone=0.05,
+                                             springForceUserFunction=UFcoordinateSpringDamper if useUserFunctions else 0))
+    mbs.Assemble()
+    return nodeList[-1]
+
+simulationSettings = exu.SimulationSettings()
+simulationSettings.timeIntegration.endTime = 0.1
+simulationSettings.timeIntegration.numberOfSteps = 100
+simulationSettings.timeIntegration.newton.useModifiedNewton = False #jacobian computed in every step
+simulationSettings.solutionSettings.writeSolutionToFile = False
+simulationSettings.linearSolverType = exu.LinearSolverType.EigenSparse
+
+results = []
+for (useUserFunctions, nThreads) in [(True, 1), (False, 1), (False, 2)]:
+    mbs.Reset()
+    nTip = CreateModel(mbs, useUserFunctions)
+    simulationSettings.numberOfThreads = nThreads
+    SC.TimeIntegrationSolve(mbs, 'GeneralizedAlpha', simulationSettings)
+
+    u = mbs.GetNodeOutput(nTip, exu.OutputVariableType.Position)
+    exu.Print('user functions =', useUserFunctions, ', numberOfThreads =', nThreads, ': u =', u)
+    results += [u[0]+u[1]]
+
+exudynTestGlobals.testError = results[0] - (1.9721832165931499) #2026-10-16: sum of tip position components for numerical connector jacobian (user functions)
+#autodiff jacobians (1 and 2 threads) must reproduce numerical connector jacobian (differences only due to Newton tolerance):
+for i in range(1, len(results)):
+    if abs(results[i]-results[0]) > 1e-10:
+        exu.Print('ERROR: autodiff jacobian run', i, 'differs from numerical connector jacobian by', results[i]-results[0])
+        exudynTestGlobals.testError += 1
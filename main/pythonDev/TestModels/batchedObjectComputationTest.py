@@ -0,0 +1,82 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test for batched computation of spring-dampers and mass points (simulationSettings.batchedObjectComputation);
+#           3D chain of mass points with spring-dampers attached to ground, node markers, body markers with local position,
+#           an inactive spring-damper and a spring-damper to a rigid body (computed per object);
+#           batched computation must give identical results to per-object computation, also multithreaded
+#
+# Author:   agent
+# Date:     2026-10-16
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+import sys
+sys.path.append('../TestModels')            #for modelUnitTest as this example may be used also as a unit test
+
+import exudyn as exu
+from exudyn.itemInterface import *
+from exudyn.utilities import *
+
+from modelUnitTests import ExudynTestStructure, exudynTestGlobals
+
+SC = exu.SystemContainer()
+mbs = SC.AddSystem()
+
+oGround = mbs.AddObject(ObjectGround(referencePosition=[0,0.1,0]))
+mLast = mbs.AddMarker(MarkerBodyPosition(bodyNumber=oGround, localPosition=[-0.1,-0.1,0]))
+nMasses = 10
+springList = []
+for i in range(nMasses):
+    n = mbs.AddNode(NodePoint(referenceCoordinates=[0.5*(i+1),0,0], initialVelocities=[0,0,0.1*i]))
+    oMass = mbs.AddObject(MassPoint(physicsMass=1, nodeNumber=n))
+    mbs.AddLoad(Force(markerNumber=mbs.AddMarker(MarkerNodePosition(nodeNumber=n)), loadVector=[0,-9.81,0]))
+    if i%2 == 0:
+        mMass = mbs.AddMarker(MarkerNodePosition(nodeNumber=n))
+    else:
+        mMass = mbs.AddMarker(MarkerBodyPosition(bodyNumber=oMass, localPosition=[0.02,0,0.01]))
+    springList += [mbs.AddObject(SpringDamper(markerNumbers=[mLast, mMass], stiffness=2000, damping=2, referenceLength=0.5, force=1))]
+    mLast = mMass
+
+#spring-damper from last mass point to ground (ground marker as second marker) and inactive spring-damper
+mGround = mbs.AddMarker(MarkerBodyPosition(bodyNumber=oGround, localPosition=[0.5*(nMasses+1),0,0]))
+mbs.AddObject(SpringDamper(markerNumbers=[mLast, mGround], stiffness=500, damping=1, referenceLength=0.6))
+mbs.AddObject(SpringDamper(markerNumbers=[mGround, mLast], stiffness=1e5, referenceLength=0, activeConnector=False))
+
+#spring-damper to rigid body is computed per object
+nRB = mbs.AddNode(Rigid2D(referenceCoordinates=[0,-1,0]))
+oRB = mbs.AddObject(RigidBody2D(physicsMass=1, physicsInertia=0.1, nodeNumber=nRB))
+mRB = mbs.AddMarker(MarkerBodyPosition(bodyNumber=oRB, localPosition=[0.2,0,0]))
+mbs.AddObject(SpringDamper(markerNumbers=[mRB, mbs.AddMarker(MarkerBodyPosition(bodyNumber=oGround, localPosition=[0,-0.5,0]))], stiffness=100, referenceLength=0.3))
+mbs.AddObject(SpringDamper(markerNumbers=[mRB, mLast], stiffness=100, damping=1, referenceLength=11))
+
+mbs.Assemble()
+
+simulationSettings = exu.SimulationSettings()
+simulationSettings.timeIntegration.endTime = 0.2
+simulationSettings.timeIntegration.numberOfSteps = 200
+simulationSettings.solutionSettings.writeSolutionToFile = False
+
+results = []
+uList = []
+for (batched, nThreads) in [(False, 1), (True, 1), (False, 3), (True, 3)]:
+    simulationSettings.batchedObjectComputation = batched
+    simulationSettings.numberOfThreads = nThreads
+    mbs.SetObjectParameter(springList[3], 'stiffness', 2000) #reset stiffness changed below
+    SC.TimeIntegrationSolve(mbs, 'GeneralizedAlpha', simulationSettings)
+    #changed parameter must be used in batched computation without Assemble()
+    mbs.SetObjectParameter(springList[3], 'stiffness', 500)
+    SC.TimeIntegrationSolve(mbs, 'GeneralizedAlpha', simulationSettings)
+
+    u = mbs.systemData.GetODE2Coordinates()
+    exu.Print('batched =', batched, ', numberOfThreads =', nThreads, ': sum(u) =', sum(u))
+    results += [sum(u)]
+    uList += [u]
+
+exudynTestGlobals.testError = results[0] - (0.13141429887452372) #2026-10-16: per-object computation
+#batched and multithreaded computation must reproduce per-object computation exactly:
+for i in range(1, len(results)):
+    if max(abs(uList[i]-uList[0])) != 0:
+        exu.Print('ERROR: configuration', i, 'differs from per-object computation by', max(abs(uList[i]-uList[0])))
+        exudynTestGlobals.testError += 1
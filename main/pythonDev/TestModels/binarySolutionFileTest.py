@@ -0,0 +1,96 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test for binary solution and sensor files (solutionSettings.binarySolutionFile);
+#           files are loaded with LoadSolutionFile/LoadBinaryFile and compared with current state of system;
+#           second run without text header appends rows to existing files; appending with different layout must be rejected
+#
+# Author:   agent
+# Date:     2026-10-16
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+import sys
+sys.path.append('../TestModels')            #for modelUnitTest as this example may be used also as a unit test
+
+import exudyn as exu
+from exudyn.itemInterface import *
+from exudyn.utilities import LoadSolutionFile, LoadBinaryFile
+
+from modelUnitTests import ExudynTestStructure, exudynTestGlobals
+
+SC = exu.SystemContainer()
+mbs = SC.AddSystem()
+
+#chain of masses connected by springs
+nMasses = 5
+nGround = mbs.AddNode(NodePointGround(referenceCoordinates=[0,0,0]))
+mPrevious = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber=nGround, coordinate=0))
+for i in range(nMasses):
+    n = mbs.AddNode(Node1D(referenceCoordinates=[0], initialCoordinates=[0.01*(i+1)], initialVelocities=[0]))
+    mbs.AddObject(Mass1D(physicsMass=1, nodeNumber=n))
+    m = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber=n, coordinate=0))
+    mbs.AddObject(CoordinateSpringDamper(markerNumbers=[mPrevious, m], stiffness=1000, damping=1))
+    mPrevious = m
+
+mbs.AddSensor(SensorNode(nodeNumber=n, fileName='solution/binarySensorTest.bin', 
+                         outputVariableType=exu.OutputVariableType.Coordinates_t))
+
+mbs.Assemble()
+
+simulationSettings = exu.SimulationSettings()
+simulationSettings.timeIntegration.endTime = 0.5
+simulationSettings.timeIntegration.numberOfSteps = 500
+simulationSettings.solutionSettings.solutionWritePeriod = 0.01
+simulationSettings.solutionSettings.sensorsWritePeriod = 0.01
+simulationSettings.solutionSettings.coordinatesSolutionFileName = 'solution/binarySolutionTest.bin'
+simulationSettings.solutionSettings.binarySolutionFile = True
+
+SC.TimeIntegrationSolve(mbs, 'GeneralizedAlpha', simulationSettings)
+
+solution = LoadSolutionFile('solution/binarySolutionTest.bin') #detects binary file
+sensor = LoadBinaryFile('solution/binarySensorTest.bin', memoryMapped=True)
+
+lastRow = solution['data'][-1]
+exu.Print('solution rows =', solution['nRows'], ', columns =', solution['columnsExported'])
+exu.Print('sensor rows =', sensor['nRows'], ', last row =', sensor['data'][-1])
+
+#binary values must be exactly the values of the system
+errorU = sum(abs(lastRow[1:1+nMasses] - mbs.systemData.GetODE2Coordinates()))
+errorV = abs(sensor['data'][-1][1] - mbs.GetNodeOutput(n, exu.OutputVariableType.Coordinates_t))
+exu.Print('difference to system state =', errorU + errorV)
+
+del sensor #release memory map of file
+
+exudynTestGlobals.testError = sum(lastRow) - (7.208080018987643) #2026-10-16: time + coordinates, velocities and accelerations of last row
+if errorU + errorV != 0:
+    exu.Print('ERROR: binary file differs from system state by', errorU + errorV)
+    exudynTestGlobals.testError += 1
+
+#second run restarts from initial values and appends same rows to existing files; binary header is needed also without text header
+simulationSettings.solutionSettings.appendToFile = True
+simulationSettings.solutionSettings.writeFileHeader = False
+SC.TimeIntegrationSolve(mbs, 'GeneralizedAlpha', simulationSettings)
+
+solution2 = LoadSolutionFile('solution/binarySolutionTest.bin')
+sensor2 = LoadBinaryFile('solution/binarySensorTest.bin')
+exu.Print('appended: solution rows =', solution2['nRows'], ', sensor rows =', sensor2['nRows'])
+nRows = solution['nRows']
+nSensorRows = sensor2['nRows']//2
+if (solution2['nRows'] != 2*nRows or solution2['columnsExported'] != solution['columnsExported'] or 
+    abs(solution2['data'][nRows:] - solution2['data'][:nRows]).max() != 0 or
+    sensor2['nRows'] != 2*nSensorRows or abs(sensor2['data'][nSensorRows:] - sensor2['data'][:nSensorRows]).max() != 0):
+    exu.Print('ERROR: appended rows differ from first run')
+    exudynTestGlobals.testError += 1
+
+#appending rows with different number of columns must not corrupt existing file
+simulationSettings.solutionSettings.exportAccelerations = False
+try:
+    SC.TimeIntegrationSolve(mbs, 'GeneralizedAlpha', simulationSettings)
+except:
+    pass #error raised for solution file is expected
+solution3 = LoadSolutionFile('solution/binarySolutionTest.bin')
+if solution3['nRows'] != 2*nRows:
+    exu.Print('ERROR: incompatible rows appended to binary solution file')
+    exudynTestGlobals.testError += 1
@@ -0,0 +1,79 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test for compressed system-wide numerical differentiation (column coloring, compressedSystemWideDifferentiation);
+#           chain of mass points with spring-dampers, attached to rigid body with body-fixed force and to ANCF cable;
+#           compressed jacobian must reproduce column-by-column system-wide differentiation for dense and sparse solver
+#
+# Author:   agent
+# Date:     2026-10-16
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+import sys
+sys.path.append('../TestModels')            #for modelUnitTest as this example may be used also as a unit test
+
+import exudyn as exu
+from exudyn.itemInterface import *
+from exudyn.utilities import *
+
+from modelUnitTests import ExudynTestStructure, exudynTestGlobals
+
+SC = exu.SystemContainer()
+mbs = SC.AddSystem()
+
+#ANCF cable, clamped at left end
+L = 1
+cableTemplate = Cable2D(physicsMassPerLength=2, physicsBendingStiffness=50, physicsAxialStiffness=1e4)
+[nodeList, objectList, loadList, nodePositionList, dummy] = GenerateStraightLineANCFCable2D(mbs=mbs,
+    positionOfNode0=[-L,0], positionOfNode1=[0,0], numberOfElements=4, cableTemplate=cableTemplate,
+    massProportionalLoad=[0,-9.81,0], fixedConstraintsNode0=[1,1,0,1], fixedConstraintsNode1=[0,0,0,0])
+
+#rigid body at tip of cable with body-fixed (follower) force
+nRB = mbs.AddNode(Rigid2D(referenceCoordinates=[0.1,0,0]))
+oRB = mbs.AddObject(RigidBody2D(physicsMass=1, physicsInertia=0.01, nodeNumber=nRB))
+mRBleft = mbs.AddMarker(MarkerBodyPosition(bodyNumber=oRB, localPosition=[-0.1,0,0]))
+mTip = mbs.AddMarker(MarkerNodePosition(nodeNumber=nodeList[-1]))
+mbs.AddObject(CartesianSpringDamper(markerNumbers=[mTip, mRBleft], stiffness=[5e3,5e3,0], damping=[5,5,0]))
+mbs.AddLoad(Force(markerNumber=mbs.AddMarker(MarkerBodyRigid(bodyNumber=oRB, localPosition=[0.1,0,0])),
+                  loadVector=[0,-2,0], bodyFixed=True))
+
+#chain of mass points
+mLast = mbs.AddMarker(MarkerBodyPosition(bodyNumber=oRB, localPosition=[0.1,0,0]))
+for i in range(20):
+    n = mbs.AddNode(NodePoint2D(referenceCoordinates=[0.1*(i+3),0]))
+    oMass = mbs.AddObject(MassPoint2D(physicsMass=0.1, nodeNumber=n))
+    mMass = mbs.AddMarker(MarkerBodyPosition(bodyNumber=oMass, localPosition=[0,0,0]))
+    mbs.AddLoad(Force(markerNumber=mMass, loadVector=[0,-0.981,0]))
+    mbs.AddObject(SpringDamper(markerNumbers=[mLast, mMass], stiffness=1000, damping=1, referenceLength=0.1))
+    mLast = mMass
+
+mbs.Assemble()
+
+simulationSettings = exu.SimulationSettings()
+simulationSettings.timeIntegration.endTime = 0.1
+simulationSettings.timeIntegration.numberOfSteps = 100
+simulationSettings.timeIntegration.newton.useModifiedNewton = False #jacobian computed in every step
+simulationSettings.timeIntegration.newton.numericalDifferentiation.doSystemWideDifferentiation = True
+simulationSettings.solutionSettings.writeSolutionToFile = False
+
+results = []
+for (solverType, compressed) in [(exu.LinearSolverType.EXUdense, False),
+                                 (exu.LinearSolverType.EXUdense, True),
+                                 (exu.LinearSolverType.EigenSparse, False),
+                                 (exu.LinearSolverType.EigenSparse, True)]:
+    simulationSettings.linearSolverType = solverType
+    simulationSettings.timeIntegration.newton.numericalDifferentiation.compressedSystemWideDifferentiation = compressed
+    SC.TimeIntegrationSolve(mbs, 'GeneralizedAlpha', simulationSettings)
+
+    u = mbs.systemData.GetODE2Coordinates()
+    exu.Print('solver =', solverType, ', compressed =', compressed, ': sum(u) =', sum(u))
+    results += [sum(u)]
+
+exudynTestGlobals.testError = results[0] - (-1.1744878330485278) #2026-10-16: dense solver, column-by-column system-wide differentiation
+#compressed jacobian and sparse solver must reproduce column-by-column jacobian with dense solver (system starts at rest):
+for i in range(1, len(results)):
+    if abs(results[i]-results[0]) > 1e-10:
+        exu.Print('ERROR: configuration', i, 'differs from column-by-column jacobian with dense solver by', results[i]-results[0])
+        exudynTestGlobals.testError += 1
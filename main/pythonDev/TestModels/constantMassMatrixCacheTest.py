@@ -0,0 +1,94 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test for generalized-alpha with cached constant mass matrix (reuseConstantMassMatrix);
+#           chain of mass points (constant mass matrix) attached to rigid body with Euler parameters (state-dependent mass matrix);
+#           results with and without cache and with dense and sparse solver must agree;
+#           mass changed with SetObjectParameter during simulation must invalidate cache
+#
+# Author:   agent
+# Date:     2026-10-16
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+import sys
+sys.path.append('../TestModels')            #for modelUnitTest as this example may be used also as a unit test
+
+import exudyn as exu
+from exudyn.itemInterface import *
+from exudyn.rigidBodyUtilities import AngularVelocity2EulerParameters_t
+
+from modelUnitTests import ExudynTestStructure, exudynTestGlobals
+
+SC = exu.SystemContainer()
+mbs = SC.AddSystem()
+
+oGround = mbs.AddObject(ObjectGround())
+mGround = mbs.AddMarker(MarkerBodyPosition(bodyNumber=oGround, localPosition=[0,0,0]))
+
+#rigid body with Euler parameters: mass matrix depends on coordinates
+ep0 = [1,0,0,0] #Euler parameters for zero rotation
+nRB = mbs.AddNode(NodeRigidBodyEP(referenceCoordinates=[0,0,0]+ep0, initialVelocities=[0,0,0]+list(AngularVelocity2EulerParameters_t([2,4,1], ep0))))
+oRB = mbs.AddObject(ObjectRigidBody(physicsMass=10, physicsInertia=[0.2,0.5,0.3,0,0,0.01], nodeNumber=nRB))
+mRB = mbs.AddMarker(MarkerBodyRigid(bodyNumber=oRB, localPosition=[0,0,0]))
+mbs.AddObject(CartesianSpringDamper(markerNumbers=[mGround, mRB], stiffness=[1e4,1e4,1e4], damping=[10,10,10]))
+
+#chain of mass points (constant mass matrix), attached eccentrically to rigid body
+mLast = mbs.AddMarker(MarkerBodyPosition(bodyNumber=oRB, localPosition=[0.5,0,0]))
+for i in range(4):
+    nMP = mbs.AddNode(NodePoint(referenceCoordinates=[0.5*(i+2),0,0]))
+    oMP = mbs.AddObject(MassPoint(physicsMass=0.5, nodeNumber=nMP))
+    mMP = mbs.AddMarker(MarkerBodyPosition(bodyNumber=oMP, localPosition=[0,0,0]))
+    mbs.AddObject(CartesianSpringDamper(markerNumbers=[mLast, mMP], stiffness=[2e3,2e3,2e3], damping=[1,1,1], offset=[0.5,0,0]))
+    mbs.AddLoad(Force(markerNumber=mMP, loadVector=[0,0,-9.81*0.5]))
+    mLast = mMP
+
+mbs.Assemble()
+
+simulationSettings = exu.SimulationSettings()
+simulationSettings.timeIntegration.endTime = 0.5
+simulationSettings.timeIntegration.numberOfSteps = 500
+simulationSettings.timeIntegration.generalizedAlpha.spectralRadius = 0.6
+simulationSettings.timeIntegration.newton.useModifiedNewton = True
+simulationSettings.solutionSettings.writeSolutionToFile = False
+
+#sparse solver does not compute initial accelerations, therefore sparse runs are only compared with each other
+results = []
+for (sparse, reuse) in [(False, False), (False, True), (True, False), (True, True)]:
+    simulationSettings.linearSolverType = exu.LinearSolverType.EigenSparse if sparse else exu.LinearSolverType.EXUdense
+    simulationSettings.timeIntegration.generalizedAlpha.reuseConstantMassMatrix = reuse
+
+    SC.TimeIntegrationSolve(mbs, 'GeneralizedAlpha', simulationSettings)
+
+    u = mbs.GetNodeOutput(nMP, exu.OutputVariableType.Position) #last mass point
+    exu.Print('sparse =', sparse, ', reuseConstantMassMatrix =', reuse, ': u =', u)
+    results += [u[0]+u[1]+u[2]]
+
+exudynTestGlobals.testError = results[0] - (1.26648075125935) #2026-10-16: sum of position components of last mass point, dense solver without cache
+#cached mass matrix must reproduce run without cache:
+for i in [1, 3]:
+    if abs(results[i]-results[i-1]) > 1e-10:
+        exu.Print('ERROR: cached mass matrix (sparse =', i==3, ') differs from run without cache by', results[i]-results[i-1])
+        exudynTestGlobals.testError += 1
+
+#mass of last mass point is doubled during simulation; cached mass matrix must be updated
+def UFchangeMass(mbs, t):
+    mbs.SetObjectParameter(oMP, 'physicsMass', 0.5 if t < 0.25 else 1.)
+    return True
+mbs.SetPreStepUserFunction(UFchangeMass)
+
+simulationSettings.linearSolverType = exu.LinearSolverType.EXUdense
+resultsMass = []
+for reuse in [False, True]:
+    mbs.SetObjectParameter(oMP, 'physicsMass', 0.5) #initial accelerations are computed before preStepUserFunction
+    simulationSettings.timeIntegration.generalizedAlpha.reuseConstantMassMatrix = reuse
+    SC.TimeIntegrationSolve(mbs, 'GeneralizedAlpha', simulationSettings)
+
+    u = mbs.GetNodeOutput(nMP, exu.OutputVariableType.Position)
+    exu.Print('changed mass, reuseConstantMassMatrix =', reuse, ': u =', u)
+    resultsMass += [u[0]+u[1]+u[2]]
+
+if abs(resultsMass[1]-resultsMass[0]) > 1e-10 or abs(resultsMass[0]-results[0]) < 1e-6:
+    exu.Print('ERROR: changed mass not considered with cached mass matrix:', resultsMass[1]-resultsMass[0], resultsMass[0]-results[0])
+    exudynTestGlobals.testError += 1
@@ -0,0 +1,85 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test for LU factorization of dense system matrices (LinearSolverType.EXUdense);
+#           linear chain of 1D masses with coordinate spring-dampers and coordinate constraint (saddle point system with zero diagonal);
+#           dense LU factorization, reused for several Newton iterations in modified Newton,
+#           must give same results as sparse solver; system jacobian is not overwritten by factorization
+#
+# Author:   agent
+# Date:     2026-10-16
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+import sys
+sys.path.append('../TestModels')            #for modelUnitTest as this example may be used also as a unit test
+
+import exudyn as exu
+from exudyn.itemInterface import *
+from exudyn.utilities import *
+
+from modelUnitTests import ExudynTestStructure, exudynTestGlobals
+import numpy as np
+
+SC = exu.SystemContainer()
+mbs = SC.AddSystem()
+
+#linear chain of 1D masses with coordinate spring-dampers; Newton converges in one iteration,
+#  therefore dense and sparse solver agree up to round-off
+nGround = mbs.AddNode(NodePointGround(referenceCoordinates=[0,0,0]))
+mGround = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber=nGround, coordinate=0))
+mLast = mGround
+nMasses = 150
+for i in range(nMasses):
+    n = mbs.AddNode(Node1D(referenceCoordinates=[0], initialCoordinates=[0], initialVelocities=[0]))
+    mbs.AddObject(Mass1D(physicsMass=0.1+0.001*i, nodeNumber=n))
+    mNode = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber=n, coordinate=0))
+    mbs.AddLoad(LoadCoordinate(markerNumber=mNode, load=0.1*(i%3-1)))
+    mbs.AddObject(CoordinateSpringDamper(markerNumbers=[mLast, mNode], stiffness=1000, damping=1))
+    mLast = mNode
+
+#constraint at end of chain; algebraic equation leads to zero diagonal entry ==> requires pivoting
+mbs.AddObject(CoordinateConstraint(markerNumbers=[mGround, mLast], offset=0.01))
+
+mbs.Assemble()
+
+simulationSettings = exu.SimulationSettings()
+simulationSettings.timeIntegration.endTime = 0.05
+simulationSettings.timeIntegration.numberOfSteps = 50
+simulationSettings.solutionSettings.writeSolutionToFile = False
+
+results = []
+for (solverType, modifiedNewton) in [(exu.LinearSolverType.EXUdense, False),
+                                     (exu.LinearSolverType.EXUdense, True),
+                                     (exu.LinearSolverType.EigenSparse, False),
+                                     (exu.LinearSolverType.EigenSparse, True)]:
+    simulationSettings.linearSolverType = solverType
+    simulationSettings.timeIntegration.newton.useModifiedNewton = modifiedNewton
+    SC.TimeIntegrationSolve(mbs, 'GeneralizedAlpha', simulationSettings)
+
+    u = mbs.systemData.GetODE2Coordinates()
+    exu.Print('solver =', solverType, ', modifiedNewton =', modifiedNewton, ': sum(u) =', sum(u))
+    results += [sum(u)]
+
+exudynTestGlobals.testError = results[0] - (0.036721327198836196) #2026-10-16: dense LU solver, full Newton
+#sparse solver must give same results as dense LU solver; modified Newton (reuse of LU factorization) converges to same solution:
+for (i, j, tol) in [(0, 2, 1e-10), (1, 3, 1e-10), (0, 1, 1e-8)]:
+    if abs(results[i]-results[j]) > tol:
+        exu.Print('ERROR: configuration', i, 'differs from configuration', j, 'by', results[i]-results[j])
+        exudynTestGlobals.testError += 1
+
+#jacobian is kept after factorization; dense and sparse jacobian must be identical
+jacobians = []
+simulationSettings.timeIntegration.newton.useModifiedNewton = False
+for solverType in [exu.LinearSolverType.EXUdense, exu.LinearSolverType.EigenSparse]:
+    simulationSettings.linearSolverType = solverType
+    solver = exu.MainSolverImplicitSecondOrder()
+    solver.InitializeSolver(mbs, simulationSettings)
+    solver.SolveSteps(mbs, simulationSettings)
+    jacobians += [solver.GetSystemJacobian()]
+    solver.FinalizeSolver(mbs, simulationSettings)
+
+if np.max(abs(jacobians[0] - jacobians[1])) > 1e-10:
+    exu.Print('ERROR: dense jacobian differs from sparse jacobian after factorization')
+    exudynTestGlobals.testError += 1
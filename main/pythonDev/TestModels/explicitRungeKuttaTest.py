@@ -0,0 +1,62 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test for explicit time integration with RungeKutta4 and DormandPrince45 (step size control);
+#           rigid body with Lie group node (NodeRigidBodyRotVecLG) attached to ground by spring
+#
+# Author:   agent
+# Date:     2026-10-16
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+import sys
+sys.path.append('../TestModels')            #for modelUnitTest as this example may be used also as a unit test
+
+import exudyn as exu
+from exudyn.itemInterface import *
+
+from modelUnitTests import ExudynTestStructure, exudynTestGlobals
+
+SC = exu.SystemContainer()
+mbs = SC.AddSystem()
+
+oGround = mbs.AddObject(ObjectGround())
+mGround = mbs.AddMarker(MarkerBodyPosition(bodyNumber=oGround, localPosition=[0,0,0]))
+
+#rigid body with Lie group node; explicit solver uses Lie group Runge-Kutta method for rotations
+nRB = mbs.AddNode(NodeRigidBodyRotVecLG(referenceCoordinates=[0,0,0]+[0.1,0.2,0.3], initialVelocities=[0,0,0]+[2,10,-5]))
+oRB = mbs.AddObject(ObjectRigidBody(physicsMass=15, physicsInertia=[0.2,0.5,0.3,0,0,0.01], nodeNumber=nRB))
+
+mBody = mbs.AddMarker(MarkerBodyPosition(bodyNumber=oRB, localPosition=[0,0.5,0.1]))
+mbs.AddObject(CartesianSpringDamper(markerNumbers=[mGround, mBody], stiffness=[1e4,1e4,1e4], offset=[0,0.5,0.1]))
+
+mMass = mbs.AddMarker(MarkerBodyMass(bodyNumber=oRB))
+mbs.AddLoad(Gravity(markerNumber=mMass, loadVector=[0,0,-9.81]))
+
+mbs.Assemble()
+
+simulationSettings = exu.SimulationSettings()
+simulationSettings.timeIntegration.endTime = 0.5
+simulationSettings.solutionSettings.writeSolutionToFile = False
+
+results = []
+#RK4 with constant step size; DormandPrince45 with step size control (numberOfSteps defines maximum step size)
+for (solverName, numberOfSteps, adaptiveStep) in [('RungeKutta4', 4000, False), ('DormandPrince45', 20, True)]:
+    simulationSettings.timeIntegration.numberOfSteps = numberOfSteps
+    simulationSettings.timeIntegration.adaptiveStep = adaptiveStep
+    simulationSettings.timeIntegration.absoluteTolerance = 1e-8
+    simulationSettings.timeIntegration.relativeTolerance = 1e-8
+
+    SC.TimeIntegrationSolve(mbs, solverName, simulationSettings)
+
+    omega = mbs.GetNodeOutput(nRB, exu.OutputVariableType.AngularVelocity)
+    exu.Print(solverName, ': omega =', omega)
+    results += [omega[0]+omega[1]+omega[2]]
+
+exu.Print('difference RungeKutta4 / DormandPrince45 =', results[1]-results[0])
+exudynTestGlobals.testError = results[0] - (-4.0182748625393) #2026-10-16: sum of angular velocity components of RK4
+#DormandPrince45 with step size control must agree with RK4 within the discretization error of RK4 (approx. 1e-7):
+if abs(results[1]-results[0]) > 1e-6:
+    exu.Print('ERROR: RungeKutta4 and DormandPrince45 differ by', results[1]-results[0])
+    exudynTestGlobals.testError += 1
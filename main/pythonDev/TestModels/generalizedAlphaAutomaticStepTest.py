@@ -0,0 +1,81 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test for generalized-alpha with automatic step size control based on local error estimate;
+#           damped oscillator which comes to rest (quiet phase), followed by a load step
+#
+# Author:   agent
+# Date:     2026-10-16
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+import sys
+sys.path.append('../TestModels')            #for modelUnitTest as this example may be used also as a unit test
+
+import exudyn as exu
+from exudyn.itemInterface import *
+
+from modelUnitTests import ExudynTestStructure, exudynTestGlobals
+
+SC = exu.SystemContainer()
+mbs = SC.AddSystem()
+
+mass = 1
+stiffness = 1e4
+damping = 20
+tLoad = 1 #time at which load is applied
+
+nGround = mbs.AddNode(NodePointGround(referenceCoordinates=[0,0,0]))
+mGround = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber=nGround, coordinate=0))
+
+n1 = mbs.AddNode(Node1D(referenceCoordinates=[0], initialCoordinates=[0.1], initialVelocities=[0]))
+mbs.AddObject(Mass1D(physicsMass=mass, nodeNumber=n1))
+mNode = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber=n1, coordinate=0))
+
+mbs.AddObject(CoordinateSpringDamper(markerNumbers=[mGround, mNode], stiffness=stiffness, damping=damping))
+
+def UFload(t, load):
+    if t >= tLoad:
+        return load
+    return 0
+mbs.AddLoad(LoadCoordinate(markerNumber=mNode, load=100, loadUserFunction=UFload))
+
+mbs.Assemble()
+
+simulationSettings = exu.SimulationSettings()
+simulationSettings.timeIntegration.endTime = 1.5
+simulationSettings.timeIntegration.numberOfSteps = 150 #defines maximum step size
+simulationSettings.timeIntegration.adaptiveStep = True
+simulationSettings.timeIntegration.automaticStepSize = True
+simulationSettings.timeIntegration.absoluteTolerance = 1e-6
+simulationSettings.timeIntegration.relativeTolerance = 1e-6
+simulationSettings.solutionSettings.writeSolutionToFile = False
+
+dynamicSolver = exu.MainSolverImplicitSecondOrder()
+
+#reference run with constant step size:
+simulationSettings.timeIntegration.automaticStepSize = False
+dynamicSolver.SolveSystem(mbs, simulationSettings)
+stepsFixed = dynamicSolver.it.currentStepIndex-1
+
+simulationSettings.timeIntegration.automaticStepSize = True
+dynamicSolver.SolveSystem(mbs, simulationSettings)
+
+u = mbs.GetNodeOutput(n1, exu.OutputVariableType.Coordinates)
+steps = dynamicSolver.it.currentStepIndex-1
+rejectedSteps = dynamicSolver.it.rejectedSteps
+hMin = dynamicSolver.it.smallestStepSize
+hMax = dynamicSolver.it.largestStepSize
+exu.Print('displacement =', u)
+exu.Print('steps =', steps, '(constant step size:', stepsFixed, '), rejected steps =', rejectedSteps)
+exu.Print('step size min / max =', hMin, '/', hMax)
+
+exudynTestGlobals.testError = u - (0.00996348035959501) #2026-10-16
+#step size must adapt: small steps after load step at tLoad (with rejected steps), maximum step size in quiet phase:
+maxStepSize = simulationSettings.timeIntegration.endTime/simulationSettings.timeIntegration.numberOfSteps
+if (steps == stepsFixed or rejectedSteps == 0 or rejectedSteps > steps/4 or
+    hMin >= 0.1*maxStepSize or hMin < simulationSettings.timeIntegration.minimumStepSize or 
+    abs(hMax-maxStepSize) > 1e-12):
+    exu.Print('ERROR: implausible step size adaptation')
+    exudynTestGlobals.testError += 1
@@ -0,0 +1,64 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test for generalized-alpha with matrix-free residual (matrixFreeResidual);
+#           ANCF cable cantilever with 2D rigid body at tip, falling under gravity;
+#           residual M*a is computed body by body without global mass matrix and must agree with assembled mass matrix
+#
+# Author:   agent
+# Date:     2026-10-16
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+import sys
+sys.path.append('../TestModels')            #for modelUnitTest as this example may be used also as a unit test
+
+import exudyn as exu
+from exudyn.itemInterface import *
+from exudyn.utilities import *
+
+from modelUnitTests import ExudynTestStructure, exudynTestGlobals
+
+SC = exu.SystemContainer()
+mbs = SC.AddSystem()
+
+L = 2       #length of cable
+nEl = 8     #number of elements
+cableTemplate = Cable2D(physicsMassPerLength=10, physicsBendingStiffness=500, physicsAxialStiffness=1e6)
+
+[nodeList, objectList, loadList, nodePositionList, dummy] = GenerateStraightLineANCFCable2D(mbs=mbs,
+    positionOfNode0=[0,0], positionOfNode1=[L,0], numberOfElements=nEl, cableTemplate=cableTemplate,
+    massProportionalLoad=[0,-9.81,0], fixedConstraintsNode0=[1,1,0,1], fixedConstraintsNode1=[0,0,0,0])
+
+#rigid body at tip of cable, attached by spring-dampers
+nRB = mbs.AddNode(Rigid2D(referenceCoordinates=[L+0.1,0,0]))
+oRB = mbs.AddObject(RigidBody2D(physicsMass=2, physicsInertia=0.05, nodeNumber=nRB))
+mRB = mbs.AddMarker(MarkerBodyPosition(bodyNumber=oRB, localPosition=[-0.1,0,0]))
+mTip = mbs.AddMarker(MarkerNodePosition(nodeNumber=nodeList[-1]))
+mbs.AddObject(CartesianSpringDamper(markerNumbers=[mTip, mRB], stiffness=[1e4,1e4,0], damping=[10,10,0]))
+mbs.AddLoad(Force(markerNumber=mRB, loadVector=[0,-2*9.81,0]))
+
+mbs.Assemble()
+
+simulationSettings = exu.SimulationSettings()
+simulationSettings.timeIntegration.endTime = 0.2
+simulationSettings.timeIntegration.numberOfSteps = 200
+simulationSettings.solutionSettings.writeSolutionToFile = False
+simulationSettings.linearSolverType = exu.LinearSolverType.EigenSparse
+
+results = []
+for matrixFree in [False, True]:
+    simulationSettings.timeIntegration.generalizedAlpha.matrixFreeResidual = matrixFree
+
+    SC.TimeIntegrationSolve(mbs, 'GeneralizedAlpha', simulationSettings)
+
+    u = mbs.GetNodeOutput(nRB, exu.OutputVariableType.Position)
+    exu.Print('matrixFreeResidual =', matrixFree, ': u =', u)
+    results += [u[0]+u[1]]
+
+exudynTestGlobals.testError = results[0] - (1.854933840622206) #2026-10-16: sum of rigid body position components with assembled mass matrix
+#matrix-free residual must reproduce assembled mass matrix:
+if abs(results[1]-results[0]) > 1e-10:
+    exu.Print('ERROR: matrix-free residual differs from assembled mass matrix by', results[1]-results[0])
+    exudynTestGlobals.testError += 1
@@ -0,0 +1,80 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Spring damper grid for test of multithreaded computation of ODE2 right-hand-side and jacobian;
+#           results with numberOfThreads > 1 must be identical to serial computation
+#
+# Author:   agent
+# Date:     2026-10-16
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+import sys
+sys.path.append('../TestModels')            #for modelUnitTest as this example may be used also as a unit test
+
+import exudyn as exu
+from exudyn.itemInterface import *
+
+from modelUnitTests import ExudynTestStructure, exudynTestGlobals #for testing
+
+SC = exu.SystemContainer()
+mbs = SC.AddSystem()
+
+sqrt2 = 2**0.5
+nBodies = 24
+nBodies2 = 4
+
+#user function for one spring; such objects are computed serially:
+def springForce(t, u, v, k, d, F0):
+    return 2*k*u + d*v
+
+for j in range(nBodies2):
+    body = mbs.AddObject({'objectType': 'Ground', 'referencePosition': [0,j,0]})
+    mbs.AddMarker({'markerType': 'BodyPosition',  'bodyNumber': body,  'localPosition': [0.0, 0.0, 0.0], 'bodyFixed': False})
+    for i in range(nBodies-1):
+        node = mbs.AddNode(NodePoint2D(referenceCoordinates=[i+1, j], initialCoordinates=[0, 0]))
+        body = mbs.AddObject(MassPoint2D(physicsMass=10, nodeNumber=node))
+        mBody = mbs.AddMarker(MarkerBodyPosition(bodyNumber=body, localPosition=[0,0,0]))
+        mbs.AddLoad(Force(markerNumber = mBody, loadVector = [0, -0.25, 0]))
+
+#add spring-dampers:
+for j in range(nBodies2-1):
+    for i in range(nBodies-1):
+        mbs.AddObject(SpringDamper(markerNumbers=[j*nBodies + i,j*nBodies + i+1], stiffness=4000, damping=10, referenceLength=1))
+        mbs.AddObject(SpringDamper(markerNumbers=[j*nBodies + i,(j+1)*nBodies + i], stiffness=4000, damping=10, referenceLength=1))
+        mbs.AddObject(SpringDamper(markerNumbers=[j*nBodies + i,(j+1)*nBodies + i+1], stiffness=4000, damping=10, referenceLength=sqrt2))
+
+for i in range(nBodies-1):
+    j = nBodies2-1
+    mbs.AddObject(SpringDamper(markerNumbers=[j*nBodies + i,j*nBodies + i+1], stiffness=4000, damping=10, referenceLength=1,
+                               springForceUserFunction = springForce if i == 0 else 0))
+
+mbs.Assemble()
+
+simulationSettings = exu.SimulationSettings()
+simulationSettings.timeIntegration.numberOfSteps = 200
+simulationSettings.timeIntegration.endTime = 0.2
+simulationSettings.timeIntegration.newton.useModifiedNewton = False #jacobian computed in every step
+simulationSettings.solutionSettings.writeSolutionToFile = False
+simulationSettings.linearSolverType = exu.LinearSolverType.EigenSparse
+
+nNodes = nBodies2*(nBodies-1)
+results = []
+for nThreads in [1, 4]:
+    simulationSettings.numberOfThreads = nThreads
+    SC.TimeIntegrationSolve(mbs, 'GeneralizedAlpha', simulationSettings)
+    uSum = 0
+    for i in range(nNodes):
+        uSum += mbs.GetNodeOutput(i, exu.OutputVariableType.Displacement)[1]
+    exu.Print('numberOfThreads =', nThreads, ', sum of y-displacements =', uSum)
+    results += [uSum]
+
+exu.Print('difference serial/multithreaded =', results[1]-results[0])
+exudynTestGlobals.testError = results[0] - (-0.045260085545246936) #2026-10-16: 24 x 4 bodies, serial computation
+
+#multithreaded computation must reproduce serial computation, independently of reference value:
+if abs(results[1]-results[0]) > 1e-14:
+    exu.Print('ERROR: serial and multithreaded results differ by', results[1]-results[0])
+    exudynTestGlobals.testError += 1
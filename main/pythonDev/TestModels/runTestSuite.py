@@ -115,13 +115,21 @@ testFileList = [
                 'ANCFcontactCircleTest.py',
                 'ANCFcontactFrictionTest.py',
                 'ANCFmovingRigidBodyTest.py',
+                'analyticJacobianODE2Test.py',
                 'ACNFslidingAndALEjointTest.py',
+                'asynchronousOutputTest.py',
+                'autoDiffJacobianTest.py',
+                'binarySolutionFileTest.py',
+                'constantMassMatrixCacheTest.py',
                 'explicitLieGroupIntegratorTest.py',
+                'explicitRungeKuttaTest.py',
                 'fourBarMechanismTest.py', 
                 'genericJointUserFunctionTest.py',
                 'genericODE2test.py',
+                'generalizedAlphaAutomaticStepTest.py',
                 'heavyTop.py',
                 'manualExplicitIntegrator.py',
+                'matrixFreeResidualTest.py',
                 'PARTS_ATEs_moving.py',
                 'pendulumFriction.py',
                 'rigidBodyCOMtest.py',
@@ -129,6 +137,11 @@ testFileList = [
                 'sliderCrank3Dbenchmark.py',
                 'sliderCrankFloatingTest.py',
                 'sparseMatrixSpringDamperTest.py',
+                'sparsePatternChangeTest.py',
+                'compressedJacobianTest.py',
+                'batchedObjectComputationTest.py',
+                'denseLUsolverTest.py',
+                'sparseAllocationStatisticsTest.py',
                 'sphericalJointTest.py',
                 'springDamperUserFunctionTest.py',
                 'objectGenericODE2Test.py',
@@ -141,6 +154,7 @@ testFileList = [
                 'rollingCoinTest.py',
                 'rollingCoinPenaltyTest.py',
                 'mecanumWheelRollingDiscTest.py',
+                'multithreadedSpringDamperTest.py',
                 ]
 
 
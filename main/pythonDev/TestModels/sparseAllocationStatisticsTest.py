@@ -0,0 +1,72 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test for zero-copy sparse matrix-vector products and sparse solves (LinearSolverType.EigenSparse)
+#           and for allocation statistics of solver (solver.it.allocationsCount, solver.it.maxStepAllocations);
+#           chain of mass points with spring-dampers and constraint, solved with implicit solver, which uses
+#           sparse mass matrix multiplication and sparse solve; results must agree with dense solver
+#
+# Author:   agent
+# Date:     2026-10-16
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+import sys
+sys.path.append('../TestModels')            #for modelUnitTest as this example may be used also as a unit test
+
+import exudyn as exu
+from exudyn.itemInterface import *
+from exudyn.utilities import *
+
+from modelUnitTests import ExudynTestStructure, exudynTestGlobals
+
+SC = exu.SystemContainer()
+mbs = SC.AddSystem()
+
+oGround = mbs.AddObject(ObjectGround())
+mLast = mbs.AddMarker(MarkerBodyPosition(bodyNumber=oGround))
+nMasses = 20
+for i in range(nMasses):
+    n = mbs.AddNode(NodePoint(referenceCoordinates=[0.5*(i+1),0,0]))
+    mbs.AddObject(MassPoint(physicsMass=1+0.1*i, nodeNumber=n))
+    mNode = mbs.AddMarker(MarkerNodePosition(nodeNumber=n))
+    mbs.AddLoad(Force(markerNumber=mNode, loadVector=[0,-9.81,0.1*(i%3-1)]))
+    mbs.AddObject(SpringDamper(markerNumbers=[mLast, mNode], stiffness=1000, damping=2, referenceLength=0.5))
+    mLast = mNode
+
+#end of chain fixed by constraint, which leads to sparse jacobian of algebraic equations
+nGround = mbs.AddNode(NodePointGround(referenceCoordinates=[0.5*nMasses,0,0]))
+mbs.AddObject(CoordinateConstraint(markerNumbers=[mbs.AddMarker(MarkerNodeCoordinate(nodeNumber=nGround, coordinate=1)),
+                                                  mbs.AddMarker(MarkerNodeCoordinate(nodeNumber=n, coordinate=1))]))
+mbs.Assemble()
+
+simulationSettings = exu.SimulationSettings()
+simulationSettings.timeIntegration.endTime = 0.1
+simulationSettings.timeIntegration.numberOfSteps = 100
+simulationSettings.solutionSettings.writeSolutionToFile = False
+simulationSettings.timeIntegration.generalizedAlpha.computeInitialAccelerations = False
+
+results = []
+allocations = []
+for solverType in [exu.LinearSolverType.EXUdense, exu.LinearSolverType.EigenSparse]:
+    simulationSettings.linearSolverType = solverType
+    #implicit solver: sparse jacobian factorization and solve in every Newton iteration
+    solver = exu.MainSolverImplicitSecondOrder()
+    solver.SolveSystem(mbs, simulationSettings)
+    results += [sum(mbs.systemData.GetODE2Coordinates())]
+    allocations += [(solver.it.allocationsCount, solver.it.maxStepAllocations)]
+
+    exu.Print('solver =', solverType, ': sum(u) =', results[-1], ', allocations (total, max per step) =', allocations[-1])
+
+exudynTestGlobals.testError = results[0] - (-0.534639268981815) #2026-10-16: dense solver
+#sparse solver must give same results as dense solver:
+if abs(results[0]-results[1]) > 1e-10:
+    exu.Print('ERROR: sparse solver differs from dense solver by', results[0]-results[1])
+    exudynTestGlobals.testError += 1
+
+#steps after first step must not allocate memory for arrays, vectors and matrices (always 0 without runtime checks):
+for (total, maxStep) in allocations:
+    if total != 0 or maxStep != 0:
+        exu.Print('ERROR: memory allocations in time steps: total =', total, ', max per step =', maxStep)
+        exudynTestGlobals.testError += 1
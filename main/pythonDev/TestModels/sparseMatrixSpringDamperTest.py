@@ -102,6 +102,44 @@ u = mbs.GetNodeOutput(nBodies-2, exu.OutputVariableType.Position) #tip node
 exu.Print('static tip displacement (y)=', u[1])
 exudynTestGlobals.testError = u[1]-(-6.779862983766792) #72 x 6 bodies; CPUtime surface: 0.029 seconds
 
+#sparse solver in symmetric mode; system with constraint is a symmetric saddle point problem:
+simulationSettings.linearSolverType = exu.LinearSolverType.EigenSparseSymmetric
+SC.StaticSolve(mbs, simulationSettings)
+
+uSym = mbs.GetNodeOutput(nBodies-2, exu.OutputVariableType.Position) #tip node
+exu.Print('static tip displacement (y), symmetric mode=', uSym[1])
+if abs(uSym[1]-u[1]) > 1e-10: #must be same as EigenSparse within Newton tolerance, independently of reference value
+    exu.Print('ERROR: symmetric mode differs from EigenSparse by', uSym[1]-u[1])
+    exudynTestGlobals.testError += 1
+
+#iterative solver (BiCGSTAB + ILUT preconditioner), preconditioner reused in modified Newton:
+simulationSettings.linearSolverType = exu.LinearSolverType.EigenSparseIterative
+simulationSettings.staticSolver.newton.useModifiedNewton = True
+simulationSettings.staticSolver.newton.linearSolverTolerance = 1e-12
+staticSolver = exu.MainSolverStatic()
+staticSolver.SolveSystem(mbs, simulationSettings)
+
+uIt = mbs.GetNodeOutput(nBodies-2, exu.OutputVariableType.Position) #tip node
+exu.Print('static tip displacement (y), iterative solver=', uIt[1])
+exu.Print('linear solver iterations =', staticSolver.it.linearSolverIterationsCount, ', not converged =', staticSolver.it.linearSolverFailedCount)
+if abs(uIt[1]-u[1]) > 1e-10: #must be same as EigenSparse within Newton tolerance, independently of reference value
+    exu.Print('ERROR: iterative solver differs from EigenSparse by', uIt[1]-u[1])
+    exudynTestGlobals.testError += 1
+if staticSolver.it.linearSolverIterationsCount == 0 or staticSolver.it.linearSolverFailedCount != 0:
+    exu.Print('ERROR: invalid iterative solver statistics')
+    exudynTestGlobals.testError += 1
+
+#unreachable tolerance: linear solver must fail, also with updated preconditioner, and stop Newton:
+simulationSettings.staticSolver.newton.linearSolverTolerance = 1e-30
+simulationSettings.staticSolver.newton.linearSolverMaxIterations = 2
+simulationSettings.staticSolver.verboseMode = 0
+simulationSettings.staticSolver.adaptiveStep = False
+success = staticSolver.SolveSystem(mbs, simulationSettings)
+exu.Print('iterative solver with unreachable tolerance: success =', success, ', not converged =', staticSolver.it.linearSolverFailedCount)
+if success or staticSolver.it.linearSolverFailedCount == 0:
+    exu.Print('ERROR: failure of iterative solver not detected')
+    exudynTestGlobals.testError += 1
+
 if exudynTestGlobals.useGraphics: 
     SC.WaitForRenderEngineStopFlag()
     exu.StopRenderer() 
@@ -0,0 +1,82 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test for fixed-pattern sparse jacobian and reuse of symbolic factorization;
+#           chain of mass points with spring-dampers; a spring-damper and a coordinate constraint are
+#           switched off and on again during simulation, which changes the sparsity pattern between jacobian updates;
+#           sparse solver with per-object and system-wide numerical differentiation must reproduce dense solver
+#
+# Author:   agent
+# Date:     2026-10-16
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+import sys
+sys.path.append('../TestModels')            #for modelUnitTest as this example may be used also as a unit test
+
+import exudyn as exu
+from exudyn.itemInterface import *
+
+from modelUnitTests import ExudynTestStructure, exudynTestGlobals
+
+SC = exu.SystemContainer()
+mbs = SC.AddSystem()
+
+nMasses = 8
+oGround = mbs.AddObject(ObjectGround(referencePosition=[0,0,0]))
+mLast = mbs.AddMarker(MarkerBodyPosition(bodyNumber=oGround, localPosition=[0,0,0]))
+for i in range(nMasses):
+    n = mbs.AddNode(NodePoint2D(referenceCoordinates=[i+1,0]))
+    oMass = mbs.AddObject(MassPoint2D(physicsMass=1, nodeNumber=n))
+    mMass = mbs.AddMarker(MarkerBodyPosition(bodyNumber=oMass, localPosition=[0,0,0]))
+    mbs.AddLoad(Force(markerNumber=mMass, loadVector=[0,-10,0]))
+    mbs.AddObject(SpringDamper(markerNumbers=[mLast, mMass], stiffness=2000, damping=5, referenceLength=1))
+    mLast = mMass
+
+#switched spring-damper from tip to ground:
+mTipGround = mbs.AddMarker(MarkerBodyPosition(bodyNumber=oGround, localPosition=[nMasses,1,0]))
+oSwitchedSpring = mbs.AddObject(SpringDamper(markerNumbers=[mTipGround, mLast], stiffness=1000, damping=5, referenceLength=1))
+
+#switched constraint of vertical coordinate of center node:
+nGround = mbs.AddNode(NodePointGround(referenceCoordinates=[0,0,0]))
+mGroundCoordinate = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber=nGround, coordinate=0))
+mCenterCoordinate = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber=int(nMasses/2), coordinate=1))
+oSwitchedConstraint = mbs.AddObject(CoordinateConstraint(markerNumbers=[mGroundCoordinate, mCenterCoordinate]))
+
+mbs.Assemble()
+
+#pattern changes at t=0.02 (both off), t=0.04 (spring on) and t=0.06 (constraint on); 1e-8 avoids round off effects
+def UFswitchConnectors(mbs, t):
+    mbs.SetObjectParameter(oSwitchedSpring, 'activeConnector', not (t > 0.02+1e-8 and t < 0.04+1e-8))
+    mbs.SetObjectParameter(oSwitchedConstraint, 'activeConnector', not (t > 0.02+1e-8 and t < 0.06+1e-8))
+    return True
+
+mbs.SetPreStepUserFunction(UFswitchConnectors)
+
+simulationSettings = exu.SimulationSettings()
+simulationSettings.timeIntegration.endTime = 0.1
+simulationSettings.timeIntegration.numberOfSteps = 100
+simulationSettings.timeIntegration.newton.useModifiedNewton = False #jacobian computed in every step
+simulationSettings.timeIntegration.generalizedAlpha.useIndex2Constraints = True
+simulationSettings.timeIntegration.generalizedAlpha.useNewmark = True
+simulationSettings.solutionSettings.writeSolutionToFile = False
+
+results = []
+for (solverType, systemWide) in [(exu.LinearSolverType.EXUdense, False),
+                                 (exu.LinearSolverType.EigenSparse, False),
+                                 (exu.LinearSolverType.EigenSparse, True)]:
+    simulationSettings.linearSolverType = solverType
+    simulationSettings.timeIntegration.newton.numericalDifferentiation.doSystemWideDifferentiation = systemWide
+    SC.TimeIntegrationSolve(mbs, 'GeneralizedAlpha', simulationSettings)
+
+    u = mbs.systemData.GetODE2Coordinates()
+    exu.Print('solver =', solverType, ', system wide differentiation =', systemWide, ': sum(u) =', sum(u))
+    results += [sum(u)]
+
+exudynTestGlobals.testError = results[0] - (-0.32907482828309437) #2026-10-16: dense solver
+#sparse solver must reproduce dense solver, independently of reference value:
+for i in range(1, len(results)):
+    if abs(results[i]-results[0]) > 1e-10:
+        exu.Print('ERROR: sparse configuration', i, 'differs from dense solver by', results[i]-results[0])
+        exudynTestGlobals.testError += 1
@@ -10,6 +10,7 @@ goal: support functions, which simplify the generation of models
 import numpy as np #LoadSolutionFile
 import time        #AnimateSolution
 import copy as copy #to be able to copy e.g. lists
+import os          #LoadBinaryFile
 
 from exudyn.basicUtilities import *
 from exudyn.rigidBodyUtilities import *
@@ -192,6 +193,9 @@ def CheckInputIndexArray(indexArray, length=-1):
 #**input: fileName: string containing directory and filename of stored coordinatesSolutionFile
 #**output: dictionary with 'data': the matrix of stored solution vectors, 'columnsExported': a list with binary values showing the exported columns [nODE2, nVel2, nAcc2, nODE1, nVel1, nAlgebraic, nData],'nColumns': the number of data columns and 'nRows': the number of data rows
 def LoadSolutionFile(fileName):
+    if IsBinaryFile(fileName): #written with solutionSettings.binarySolutionFile=True
+        return LoadBinaryFile(fileName)
+
     data = np.loadtxt(fileName, comments='#', delimiter=',')
 
     fileRead=open(fileName,'r') 
@@ -213,6 +217,45 @@ def LoadSolutionFile(fileName):
 
     return dict({'data': data, 'columnsExported': columnsExported,'nColumns': nColumns,'nRows': nRows})
     
+#++++++++++++++++++++++++++++++++++++++++++++
+#**function: check if file is a binary solution or sensor file, written with exu.SimulationSettings().solutionSettings.binarySolutionFile=True
+#**input: fileName: string containing directory and filename
+#**output: True, if file starts with binary file identifier
+def IsBinaryFile(fileName):
+    with open(fileName,'rb') as file:
+        return file.read(8) == b'EXUDYNBF'
+
+#++++++++++++++++++++++++++++++++++++++++++++
+#**function: load binary solution or sensor file (written with option exu.SimulationSettings().solutionSettings.binarySolutionFile=True) into dictionary; data is read without parsing
+#**input: 
+#  fileName: string containing directory and filename of binary file
+#  memoryMapped: if True, 'data' is a read-only numpy.memmap of the file instead of an array in memory (for very large files)
+#**output: dictionary with 'data': the matrix of stored rows (first column is time), 'columnsExported': the integer information of the header (solution file: [nODE2, nVel2, nAcc2, nODE1, nVel1, nAlgebraic, nData]; sensor file: [number of sensor values]), 'nColumns': the number of data columns (excl. time), 'nRows': the number of data rows and 'header': the text header
+#**notes: file layout (little-endian): 8 bytes identifier 'EXUDYNBF'; int32 values: version, byte order mark (=1), header size in bytes, size of Real, number of columns (incl. time), number of info integers, length of text header; info integers; text header; zero padding to 8 bytes; followed by data rows; an incomplete last row (e.g. simulation still running) is ignored
+def LoadBinaryFile(fileName, memoryMapped=False):
+    with open(fileName,'rb') as file:
+        headerStart = file.read(36)
+        if len(headerStart) < 36 or headerStart[0:8] != b'EXUDYNBF':
+            raise ValueError("LoadBinaryFile: '"+fileName+"' is not an Exudyn binary file")
+        [version, byteOrder, headerSize, realSize, nColumns, nInfo, nText] = np.frombuffer(headerStart[8:36], dtype='<i4')
+        if byteOrder != 1:
+            raise ValueError("LoadBinaryFile: file has been written on platform with different byte order")
+        if version != 1:
+            raise ValueError("LoadBinaryFile: unsupported file version "+str(version))
+        columnsExported = list(np.frombuffer(file.read(4*nInfo), dtype='<i4').astype(int))
+        header = file.read(nText).decode('utf-8', errors='replace')
+
+    dataType = np.dtype('<f8') if realSize == 8 else np.dtype('<f4')
+    fileSize = os.path.getsize(fileName)
+    nRows = (fileSize - headerSize) // (realSize*nColumns)
+
+    if memoryMapped and nRows > 0: #memmap does not support empty files
+        data = np.memmap(fileName, dtype=dataType, mode='r', offset=headerSize, shape=(nRows, nColumns))
+    else:
+        data = np.fromfile(fileName, dtype=dataType, count=nRows*nColumns, offset=headerSize).reshape(nRows, nColumns)
+
+    return dict({'data': data, 'columnsExported': columnsExported,'nColumns': int(nColumns-1),'nRows': int(nRows), 'header': header})
+
 #++++++++++++++++++++++++++++++++++++++++++++
 #**function: load selected row of solution dictionary (previously loaded with LoadSolutionFile) into specific state
 def SetSolutionState(exu, mbs, solution, row, configuration):
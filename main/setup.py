@@ -71,6 +71,7 @@ ext_modules = [
                  'src/Linalg/LinearSolver.cpp',
                  'src/Linalg/Matrix.cpp',
                  'src/Linalg/Vector.cpp',
+                 'src/Linalg/SimdKernels.cpp',
                  'src/Main/CSystem.cpp',
                  'src/Main/MainObjectFactory.cpp',
                  'src/Main/MainSystem.cpp',
@@ -133,6 +134,8 @@ ext_modules = [
                  'src/Pymodules/PyMatrixContainer.cpp',
                  'src/Solver/CSolver.cpp',
                  'src/Solver/CSolverBase.cpp',
+                 'src/Solver/AsyncFileWriter.cpp',
+                 'src/Solver/CSolverExplicit.cpp',
                  'src/Solver/CSolverImplicitSecondOrder.cpp',
                  'src/Solver/CSolverStatic.cpp',
                  'src/Solver/MainSolver.cpp',
@@ -164,6 +167,7 @@ ext_modules = [
 						#('_MBCS', ''),
 						#('_WINDLL', ''),
 						('_CRT_SECURE_NO_WARNINGS', ''),
+						#('USE_EIGEN_LGPL_SOLVERS', ''), #enables LinearSolverType EigenSparseLUAMD/LDLT/LLT, which use LGPL licensed parts of Eigen
 		],
         language='c++'
     ),
@@ -238,7 +242,7 @@ class BuildExt(build_ext):
          '-Wno-non-template-friend', #deactivate warning for several vector/array templates
          '-Wno-comment', #deactivate multiline comment warning /* ... * * ...*/
          #'-fpermissive', #because of exceptions ==> allows compilation
-         #'-fopenmp',
+         '-fopenmp', #for multithreaded computation (numberOfThreads)
     		 '-Wall',
     		 '-Wno-class-memaccess', #avoid warnings on gcc-8 regarding memory access in class
     		 #'-O3', #takes long ...
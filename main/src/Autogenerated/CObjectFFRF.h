@@ -4,7 +4,7 @@
 *
 * @author       Gerstmayr Johannes
 * @date         2019-07-01 (generated)
-* @date         2020-09-08  18:14:39 (last modfied)
+* @date         2026-10-16  13:43:05 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -240,6 +240,12 @@ public: // AUTO:
         return (JacobianType::Type)(JacobianType::AE_ODE2 + JacobianType::AE_ODE2_function);
     }
 
+    //! AUTO:  return true, if object has a computational user function; such objects are not evaluated in parallel (python GIL)
+    virtual bool HasUserFunction() const override
+    {
+        return (parameters.forceUserFunction != 0 || parameters.massMatrixUserFunction != 0);
+    }
+
     //! AUTO:  Flags to determine, which access (forces, moments, connectors, ...) to object are possible
     virtual AccessFunctionType GetAccessFunctionTypes() const override;
 
@@ -4,7 +4,7 @@
 *
 * @author       Gerstmayr Johannes
 * @date         2019-07-01 (generated)
-* @date         2020-09-08  18:14:39 (last modfied)
+* @date         2026-10-16  16:03:46 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -226,6 +226,15 @@ public: // AUTO:
     //! AUTO:  return the available jacobian dependencies and the jacobians which are available as a function; if jacobian dependencies exist but are not available as a function, it is computed numerically; can be combined with 2^i enum flags
     virtual JacobianType::Type GetAvailableJacobians() const override;
 
+    //! AUTO:  Computational function: add factor*(stiffnessMatrixReduced) [velocityLevel=false] or factor*(dampingMatrixReduced) [velocityLevel=true] for flexible coordinates directly to system jacobian; sparse PyMatrixContainer matrices are added as sparse triplets
+    virtual void AddJacobianODE2_ODE2(GeneralMatrix& jacobianGM, Real factor, const ArrayIndex& ltgODE2, bool velocityLevel) const override;
+
+    //! AUTO:  return true, if object has a computational user function; such objects are not evaluated in parallel (python GIL)
+    virtual bool HasUserFunction() const override
+    {
+        return (parameters.forceUserFunction != 0 || parameters.massMatrixUserFunction != 0);
+    }
+
     //! AUTO:  Flags to determine, which access (forces, moments, connectors, ...) to object are possible
     virtual AccessFunctionType GetAccessFunctionTypes() const override;
 
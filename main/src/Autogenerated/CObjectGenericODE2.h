@@ -4,7 +4,7 @@
 *
 * @author       Gerstmayr Johannes
 * @date         2019-07-01 (generated)
-* @date         2020-09-08  18:14:39 (last modfied)
+* @date         2026-10-16  16:03:46 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -92,13 +92,25 @@ public: // AUTO:
     //! AUTO:  Computational function: compute mass matrix
     virtual void ComputeMassMatrix(Matrix& massMatrix) const override;
 
+    //! AUTO:  return true, if mass matrix does not depend on coordinates and time; used by solvers to reuse the (factorized) mass matrix
+    virtual bool HasConstantMassMatrix() const override
+    {
+        return parameters.massMatrixUserFunction == 0;
+    }
+
     //! AUTO:  Computational function: compute right-hand-side (RHS) of second order ordinary differential equations (ODE) to 'ode2rhs'
     virtual void ComputeODE2RHS(Vector& ode2Rhs) const override;
 
-    //! AUTO:  return the available jacobian dependencies and the jacobians which are available as a function; if jacobian dependencies exist but are not available as a function, it is computed numerically; can be combined with 2^i enum flags
-    virtual JacobianType::Type GetAvailableJacobians() const override
+    //! AUTO:  return the available jacobian dependencies and the jacobians which are available as a function; if jacobian dependencies exist but are not available as a function, it is computed numerically; can be combined with 2^i enum flags; analytic jacobians (stiffness and damping matrix) are available without forceUserFunction
+    virtual JacobianType::Type GetAvailableJacobians() const override;
+
+    //! AUTO:  Computational function: compute Jacobian of ODE2 LHS equations w.r.t. ODE coordinates (stiffness matrix) and w.r.t. ODE_t coordinates (damping matrix)
+    virtual void ComputeJacobianODE2_ODE2(ResizableMatrix& jacobian, ResizableMatrix& jacobian_ODE2_t) const override;
+
+    //! AUTO:  return true, if object has a computational user function; such objects are not evaluated in parallel (python GIL)
+    virtual bool HasUserFunction() const override
     {
-        return JacobianType::_None;
+        return (parameters.forceUserFunction != 0 || parameters.massMatrixUserFunction != 0);
     }
 
     //! AUTO:  Flags to determine, which access (forces, moments, connectors, ...) to object are possible
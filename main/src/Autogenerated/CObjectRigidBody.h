@@ -4,7 +4,7 @@
 *
 * @author       Gerstmayr Johannes
 * @date         2019-07-01 (generated)
-* @date         2020-09-08  18:19:09 (last modfied)
+* @date         2026-10-16  14:50:06 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -82,6 +82,12 @@ public: // AUTO:
     //! AUTO:  Computational function: compute mass matrix
     virtual void ComputeMassMatrix(Matrix& massMatrix) const override;
 
+    //! AUTO:  return true, if mass matrix does not depend on coordinates and time; used by solvers to reuse the (factorized) mass matrix
+    virtual bool HasConstantMassMatrix() const override
+    {
+        return ((Index)GetCNode(0)->GetType() & (Index)Node::RotationLieGroup) != 0 && parameters.physicsCenterOfMass == 0.;
+    }
+
     //! AUTO:  Computational function: compute right-hand-side (RHS) of second order ordinary differential equations (ODE) to 'ode2rhs'
     virtual void ComputeODE2RHS(Vector& ode2Rhs) const override;
 
@@ -4,7 +4,7 @@
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2020-08-25 (last modfied)
+* @date         AUTO: 2026-10-16 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -29,6 +29,8 @@ public: // AUTO:
   bool useTimer;                                  //!< AUTO: flag to decide, whether the timer is used (true) or not
   Real total;                                     //!< AUTO: total time measured between start and end of computation (static/dynamics)
   Real factorization;                             //!< AUTO: solve or inverse
+  Real factorizationSymbolic;                     //!< AUTO: part of factorization spent by the sparse solver backend for symbolic factorization (ordering, elimination tree); included in factorization, not counted in sum
+  LinearSolverType linearSolverType;              //!< AUTO: linear solver (backend) used for factorization; shown with factorization time in statistics
   Real newtonIncrement;                           //!< AUTO: Jac\f$^{-1}\f$ * RHS; backsubstitution
   Real integrationFormula;                        //!< AUTO: time spent for evaluation of integration formulas
   Real ODE2RHS;                                   //!< AUTO: time for residual evaluation of ODE2 right-hand-side
@@ -41,6 +43,7 @@ public: // AUTO:
   Real reactionForces;                            //!< AUTO: CqT * lambda
   Real postNewton;                                //!< AUTO: post newton step
   Real writeSolution;                             //!< AUTO: time for writing solution
+  Real writeSolutionAsync;                        //!< AUTO: time spent by background writer thread for asynchronous output (solutionSettings.writeAsynchronously); runs in parallel and is not counted in sum
   Real overhead;                                  //!< AUTO: overhead, such as initialization, copying and some matrix-vector multiplication
   Real python;                                    //!< AUTO: time spent for python functions
   Real visualization;                             //!< AUTO: time spent for visualization in computation thread
@@ -53,6 +56,8 @@ public: // AUTO:
     useTimer = true;
     total = 0.;
     factorization = 0.;
+    factorizationSymbolic = 0.;
+    linearSolverType = LinearSolverType::_None;
     newtonIncrement = 0.;
     integrationFormula = 0.;
     ODE2RHS = 0.;
@@ -65,6 +70,7 @@ public: // AUTO:
     reactionForces = 0.;
     postNewton = 0.;
     writeSolution = 0.;
+    writeSolutionAsync = 0.;
     overhead = 0.;
     python = 0.;
     visualization = 0.;
@@ -91,6 +97,8 @@ public: // AUTO:
     os << "  useTimer = " << useTimer << "\n";
     os << "  total = " << total << "\n";
     os << "  factorization = " << factorization << "\n";
+    os << "  factorizationSymbolic = " << factorizationSymbolic << "\n";
+    os << "  linearSolverType = " << linearSolverType << "\n";
     os << "  newtonIncrement = " << newtonIncrement << "\n";
     os << "  integrationFormula = " << integrationFormula << "\n";
     os << "  ODE2RHS = " << ODE2RHS << "\n";
@@ -103,6 +111,7 @@ public: // AUTO:
     os << "  reactionForces = " << reactionForces << "\n";
     os << "  postNewton = " << postNewton << "\n";
     os << "  writeSolution = " << writeSolution << "\n";
+    os << "  writeSolutionAsync = " << writeSolutionAsync << "\n";
     os << "  overhead = " << overhead << "\n";
     os << "  python = " << python << "\n";
     os << "  visualization = " << visualization << "\n";
@@ -124,7 +133,7 @@ public: // AUTO:
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2020-08-25 (last modfied)
+* @date         AUTO: 2026-10-16 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -148,6 +157,7 @@ public: // AUTO:
   Index nData;                                    //!< AUTO: number of data coordinates
   Index nSys;                                     //!< AUTO: number of system (unknown) coordinates = nODE2+nODE1+nAE
   Index startAE;                                  //!< AUTO: start of algebraic coordinates, but set to zero if nAE==0
+  bool constantMassMatrixComputed;                //!< AUTO: true: systemMassMatrix only contains the (cached) mass matrix of bodies with constant mass matrix; must be set false if systemMassMatrix is recomputed or resized
   ResizableVector systemResidual;                 //!< AUTO: system residual vector (vectors will be linked to this vector!)
   ResizableVector newtonSolution;                 //!< AUTO: Newton decrement (computed from residual and jacobian)
   ResizableVector tempODE2;                       //!< AUTO: temporary vector for ODE2 quantities; use in initial accelerations and during Newton
@@ -166,7 +176,7 @@ private: // AUTO:
   GeneralMatrixEXUdense systemJacobianDense;      //!< AUTO: dense system jacobian
   GeneralMatrixEXUdense systemMassMatrixDense;    //!< AUTO: dense mass matrix
   GeneralMatrixEXUdense jacobianAEdense;          //!< AUTO: dense AE jacobian
-  GeneralMatrixEigenSparse systemJacobianSparse;  //!< AUTO: sparse system jacobian
+  GeneralMatrixEigenSparseFixedPattern systemJacobianSparse;//!< AUTO: sparse system jacobian; keeps sparsity pattern and refills values in place
   GeneralMatrixEigenSparse systemMassMatrixSparse;//!< AUTO: sparse mass matrix
   GeneralMatrixEigenSparse jacobianAEsparse;      //!< AUTO: sparse AE jacobian
 
@@ -183,6 +193,7 @@ public: // AUTO:
     startAE = 0;
     systemJacobian = nullptr;
     systemMassMatrix = nullptr;
+    constantMassMatrixComputed = false;
     jacobianAE = nullptr;
     SetLinearSolverType(LinearSolverType::EXUdense); //for safety, data is linked initially
   };
@@ -197,6 +208,11 @@ public: // AUTO:
     return linearSolverType;
   }
 
+  //! AUTO: set relative tolerance and maximum number of iterations for iterative linear solver (EigenSparseIterative); only affects system jacobian
+  void SetIterativeSolverSettings(Real tolerance, Index maxIterations) {
+    systemJacobianSparse.SetIterativeSolverSettings(tolerance, maxIterations);
+  }
+
   //! AUTO: print function used in ostream operator (print is virtual and can thus be overloaded)
   virtual void Print(std::ostream& os) const
   {
@@ -209,6 +225,7 @@ public: // AUTO:
     os << "  startAE = " << startAE << "\n";
     os << "  systemJacobian = " << *systemJacobian << "\n";
     os << "  systemMassMatrix = " << *systemMassMatrix << "\n";
+    os << "  constantMassMatrixComputed = " << constantMassMatrixComputed << "\n";
     os << "  jacobianAE = " << *jacobianAE << "\n";
     os << "  systemResidual = " << systemResidual << "\n";
     os << "  newtonSolution = " << newtonSolution << "\n";
@@ -243,7 +260,7 @@ public: // AUTO:
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2020-08-25 (last modfied)
+* @date         AUTO: 2026-10-16 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -264,6 +281,7 @@ public: // AUTO:
   Real maxStepSize;                               //!< AUTO: constant or maximum stepSize
   Real minStepSize;                               //!< AUTO: minimum stepSize for static/dynamic solver; only used, if adaptive step is activated
   Real currentStepSize;                           //!< AUTO: stepSize of current step
+  Real recommendedStepSize;                       //!< AUTO: step size proposed by the error estimator of the time integration method for the next step; only used by methods with error control
   Index numberOfSteps;                            //!< AUTO: number of time steps (if fixed size); \f$n\f$
   Index currentStepIndex;                         //!< AUTO: current step index; \f$i\f$
   bool adaptiveStep;                              //!< AUTO: if true, the step size may be adaptively controlled
@@ -275,7 +293,19 @@ public: // AUTO:
   Index newtonStepsCount;                         //!< AUTO: count total Newton steps
   Index newtonJacobiCount;                        //!< AUTO: count total Newton jacobian computations
   Index rejectedModifiedNewtonSteps;              //!< AUTO: count the number of rejected modified Newton steps (switch to full Newton)
+  Index linearSolverIterationsCount;              //!< AUTO: count total number of iterations of iterative linear solver (EigenSparseIterative)
+  Index linearSolverFailedCount;                  //!< AUTO: count linear solves, which did not reach the tolerance (EigenSparseIterative)
   Index discontinuousIterationsCount;             //!< AUTO: count total number of discontinuous iterations (min. 1 per step)
+  Index rejectedSteps;                            //!< AUTO: count total number of rejected steps (step size reduction due to failed Newton iterations or local error estimate)
+  Real smallestStepSize;                          //!< AUTO: smallest accepted step size
+  Real largestStepSize;                           //!< AUTO: largest accepted step size
+  Index allocationsCount;                         //!< AUTO: count total number of memory allocations of arrays, vectors and matrices in steps after the first step (which allocates solver workspace); only counted if Exudyn is compiled with runtime checks (__EXUDYN_RUNTIME_CHECKS__), otherwise 0
+  Index maxStepAllocations;                       //!< AUTO: maximum number of memory allocations of arrays, vectors and matrices in one step after the first step; 0 means that steps are allocation-free; see allocationsCount
+  Index allocationsResidual;                      //!< AUTO: part of allocationsCount in residual computation (Newton update and residual, explicit right-hand-side)
+  Index allocationsJacobian;                      //!< AUTO: part of allocationsCount in computation of jacobian and mass matrix
+  Index allocationsFactorization;                 //!< AUTO: part of allocationsCount in factorization and linear solves (Newton increment)
+  Index allocationsOutput;                        //!< AUTO: part of allocationsCount in console and solution file output and visualization update
+  Index allocationsSensors;                       //!< AUTO: part of allocationsCount in evaluation and output of sensors
 
 
 public: // AUTO: 
@@ -285,6 +315,7 @@ public: // AUTO:
     maxStepSize = 0.;
     minStepSize = 0.;
     currentStepSize = 0.;
+    recommendedStepSize = 0.;
     numberOfSteps = 0;
     currentStepIndex = 0;
     adaptiveStep = true;
@@ -296,7 +327,19 @@ public: // AUTO:
     newtonStepsCount = 0;
     newtonJacobiCount = 0;
     rejectedModifiedNewtonSteps = 0;
+    linearSolverIterationsCount = 0;
+    linearSolverFailedCount = 0;
     discontinuousIterationsCount = 0;
+    rejectedSteps = 0;
+    smallestStepSize = 0.;
+    largestStepSize = 0.;
+    allocationsCount = 0;
+    maxStepAllocations = 0;
+    allocationsResidual = 0;
+    allocationsJacobian = 0;
+    allocationsFactorization = 0;
+    allocationsOutput = 0;
+    allocationsSensors = 0;
   };
 
   // AUTO: access functions
@@ -309,6 +352,7 @@ public: // AUTO:
     os << "  maxStepSize = " << maxStepSize << "\n";
     os << "  minStepSize = " << minStepSize << "\n";
     os << "  currentStepSize = " << currentStepSize << "\n";
+    os << "  recommendedStepSize = " << recommendedStepSize << "\n";
     os << "  numberOfSteps = " << numberOfSteps << "\n";
     os << "  currentStepIndex = " << currentStepIndex << "\n";
     os << "  adaptiveStep = " << adaptiveStep << "\n";
@@ -320,7 +364,19 @@ public: // AUTO:
     os << "  newtonStepsCount = " << newtonStepsCount << "\n";
     os << "  newtonJacobiCount = " << newtonJacobiCount << "\n";
     os << "  rejectedModifiedNewtonSteps = " << rejectedModifiedNewtonSteps << "\n";
+    os << "  linearSolverIterationsCount = " << linearSolverIterationsCount << "\n";
+    os << "  linearSolverFailedCount = " << linearSolverFailedCount << "\n";
     os << "  discontinuousIterationsCount = " << discontinuousIterationsCount << "\n";
+    os << "  rejectedSteps = " << rejectedSteps << "\n";
+    os << "  smallestStepSize = " << smallestStepSize << "\n";
+    os << "  largestStepSize = " << largestStepSize << "\n";
+    os << "  allocationsCount = " << allocationsCount << "\n";
+    os << "  maxStepAllocations = " << maxStepAllocations << "\n";
+    os << "  allocationsResidual = " << allocationsResidual << "\n";
+    os << "  allocationsJacobian = " << allocationsJacobian << "\n";
+    os << "  allocationsFactorization = " << allocationsFactorization << "\n";
+    os << "  allocationsOutput = " << allocationsOutput << "\n";
+    os << "  allocationsSensors = " << allocationsSensors << "\n";
     os << "\n";
   }
 
@@ -339,7 +395,7 @@ public: // AUTO:
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2020-08-25 (last modfied)
+* @date         AUTO: 2026-10-16 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -359,7 +415,7 @@ class SolverConvergenceData // AUTO:
 public: // AUTO: 
   bool stepReductionFailed;                       //!< AUTO: true, if iterations over time/static steps failed (finally, cannot be recovered)
   bool discontinuousIterationsFailed;             //!< AUTO: true, if discontinuous iterations failed (may be recovered if adaptive step is active)
-  bool linearSolverFailed;                        //!< AUTO: true, if linear solver failed to factorize
+  bool linearSolverFailed;                        //!< AUTO: true, if linear solver failed to factorize or iterative linear solver did not converge with updated Jacobian
   bool newtonConverged;                           //!< AUTO: true, if Newton has (finally) converged
   bool newtonSolutionDiverged;                    //!< AUTO: true, if Newton diverged (may be recovered)
   bool jacobianUpdateRequested;                   //!< AUTO: true, if a jacobian update is requested in modified Newton (determined in previous step)
@@ -429,7 +485,7 @@ public: // AUTO:
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2020-08-25 (last modfied)
+* @date         AUTO: 2026-10-16 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -515,7 +571,7 @@ public: // AUTO:
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2020-08-25 (last modfied)
+* @date         AUTO: 2026-10-16 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -536,6 +592,8 @@ public: // AUTO:
   std::ofstream solutionFile;                     //!< AUTO: solution file with coordinate data
   std::ofstream solverFile;                       //!< AUTO: file with detailed solver information
   std::vector<std::ofstream*> sensorFileList;     //!< AUTO: files for sensor output; the ofstream list corresponds exactly to the sensors in the computationalSystem (i.e., sensorFileList[0] is the ofstream for sensor 0, etc.); file lists need to be closed and deleted at end of simulation!
+  std::vector<char> solutionFileBuffer;           //!< AUTO: write buffer of solution file, size according to solutionSettings.outputBufferSize; must exist until solutionFile is closed
+  std::vector<std::vector<char>> sensorFileBufferList;//!< AUTO: write buffers of sensor files, corresponding to sensorFileList; must exist until sensor files are closed
 
 
 public: // AUTO: 
@@ -2,7 +2,7 @@
 // AUTO:  Helper file for dictionaries get/set for system structures; generated by Johannes Gerstmayr
 // AUTO:  Generated by Johannes Gerstmayr
 // AUTO:  Used for SimulationSettings and VisualizationSettings
-// AUTO:  last modified = 2020-08-25
+// AUTO:  last modified = 2026-10-16
 // AUTO:  ++++++++++++++++++++++
 
   #ifndef DICTIONARIESGETSET__H
@@ -151,6 +151,54 @@
     d["description"] = "precision for floating point numbers written to solution and sensor files";
     structureDict["outputPrecision"] = d;
 
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.binarySolutionFile;
+    d["type"] = "bool";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "flag (true/false); if true, solution and sensor files are written in binary format: a self-describing header (see LoadBinaryFile(...) in exudyn.utilities) followed by rows of raw little-endian Real values; the data section can be memory-mapped; outputPrecision and writeFileFooter have no effect in binary mode; the binary header is always written (writeFileHeader only controls the embedded text); with appendToFile, rows are appended to an existing binary file without a second header, if the existing header has the same layout (otherwise an error is raised and the file is not written)";
+    structureDict["binarySolutionFile"] = d;
+
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.outputBufferSize;
+    d["type"] = "Index";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "size of write buffer in bytes, which is used for the solution file and for every sensor file; larger buffers reduce the number of file system calls for large systems; values below 4096 are increased to 4096";
+    structureDict["outputBufferSize"] = d;
+
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.writeAsynchronously;
+    d["type"] = "bool";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "flag (true/false); if true, solution and sensor files are written by a background writer thread: the solver only copies the exported values into a ring buffer and continues, while formatting and file output are done in parallel; time of writer thread is shown as writeSolutionAsync in timer statistics";
+    structureDict["writeAsynchronously"] = d;
+
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.asyncBufferSize;
+    d["type"] = "Index";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "size of ring buffer in bytes for asynchronous output (writeAsynchronously); it is enlarged automatically to hold at least two solution rows";
+    structureDict["asyncBufferSize"] = d;
+
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.asyncBlockIfBufferFull;
+    d["type"] = "bool";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "flag (true/false) for asynchronous output; if true, the solver waits until the writer thread provides space in a full ring buffer (no data is lost); if false, rows are dropped if the ring buffer is full and the number of dropped rows is reported at the end of simulation";
+    structureDict["asyncBlockIfBufferFull"] = d;
+
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.asyncFlushOnFinalize;
+    d["type"] = "bool";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "flag (true/false) for asynchronous output; if true, the solver waits at the end of simulation until all buffered rows are written; if false, rows which are not yet written at the end of simulation are discarded (e.g. to stop quickly)";
+    structureDict["asyncFlushOnFinalize"] = d;
+
     d = py::dict(); //reset local dict
     d["itemIdentifier"] = std::string(""); //identifier for item
     d["value"] = data.recordImagesInterval;
@@ -179,6 +227,12 @@
     data.solverInformationFileName = py::cast<std::string>(d["solverInformationFileName"]);
     data.solutionInformation = py::cast<std::string>(d["solutionInformation"]);
     data.outputPrecision = py::cast<Index>(d["outputPrecision"]);
+    data.binarySolutionFile = py::cast<bool>(d["binarySolutionFile"]);
+    data.outputBufferSize = py::cast<Index>(d["outputBufferSize"]);
+    data.writeAsynchronously = py::cast<bool>(d["writeAsynchronously"]);
+    data.asyncBufferSize = py::cast<Index>(d["asyncBufferSize"]);
+    data.asyncBlockIfBufferFull = py::cast<bool>(d["asyncBlockIfBufferFull"]);
+    data.asyncFlushOnFinalize = py::cast<bool>(d["asyncFlushOnFinalize"]);
     data.recordImagesInterval = py::cast<Real>(d["recordImagesInterval"]);
   }
   //! AUTO: read access to structure; converting into dictionary
@@ -217,6 +271,14 @@
     d["description"] = "true: for the size estimation of the differentiation parameter, the reference coordinate q^{Ref}_i is added to ODE2 coordinates --> see; false: only the current coordinate is used for size estimation of the differentiation parameter";
     structureDict["addReferenceCoordinatesToEpsilon"] = d;
 
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.compressedSystemWideDifferentiation;
+    d["type"] = "bool";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "true: system wide differentiation (doSystemWideDifferentiation) perturbs all coordinates at once which do not share an object or node (column coloring, Curtis-Powell-Reed); needs a few ODE2RHS evaluations instead of one per coordinate for large systems with local coupling; only valid if forces of objects and loads only depend on coordinates of the object or load (not for user functions using coordinates of other items)";
+    structureDict["compressedSystemWideDifferentiation"] = d;
+
     return structureDict;
   }
   //! AUTO: write access to data structure; converting dictionary d into structure
@@ -225,6 +287,7 @@
     data.minimumCoordinateSize = py::cast<Real>(d["minimumCoordinateSize"]);
     data.doSystemWideDifferentiation = py::cast<bool>(d["doSystemWideDifferentiation"]);
     data.addReferenceCoordinatesToEpsilon = py::cast<bool>(d["addReferenceCoordinatesToEpsilon"]);
+    data.compressedSystemWideDifferentiation = py::cast<bool>(d["compressedSystemWideDifferentiation"]);
   }
   //! AUTO: read access to structure; converting into dictionary
   py::dict GetDictionaryWithTypeInfo(const NewtonSettings& data) {
@@ -343,6 +406,22 @@
     d["description"] = "this is the maximum allowed value for solutionU.L2NormSquared() which is the square of the square norm (value=u_1^2+u_2^2+...), and solutionV/A...; if the norm of solution vectors are larger, Newton method is stopped; the default value is chosen such that it would still work for single precision numbers (float)";
     structureDict["maximumSolutionNorm"] = d;
 
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.linearSolverTolerance;
+    d["type"] = "UReal";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "relative residual tolerance (|\\mathbf{A} \\Delta \\mathbf{q} - \\mathbf{r}|/|\\mathbf{r}|) for iterative linear solver (linearSolverType = EigenSparseIterative) used to compute Newton increments; 0 ... use machine precision";
+    structureDict["linearSolverTolerance"] = d;
+
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.linearSolverMaxIterations;
+    d["type"] = "Index";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "maximum number of iterations of iterative linear solver (linearSolverType = EigenSparseIterative) per Newton increment; 0 ... use 2 times number of unknowns; if the tolerance is not reached, the Newton iteration is repeated with updated Jacobian (and preconditioner); if the tolerance is still not reached, the linear solver fails, which leads to step reduction (if possible) or stops the solver";
+    structureDict["linearSolverMaxIterations"] = d;
+
     d = py::dict(); //reset local dict
     d["itemIdentifier"] = std::string(""); //identifier for item
     d["value"] = data.maxDiscontinuousIterations;
@@ -394,6 +473,8 @@
     data.maxModifiedNewtonIterations = py::cast<Index>(d["maxModifiedNewtonIterations"]);
     data.maxModifiedNewtonRestartIterations = py::cast<Index>(d["maxModifiedNewtonRestartIterations"]);
     data.maximumSolutionNorm = py::cast<Real>(d["maximumSolutionNorm"]);
+    data.linearSolverTolerance = py::cast<Real>(d["linearSolverTolerance"]);
+    data.linearSolverMaxIterations = py::cast<Index>(d["linearSolverMaxIterations"]);
     data.maxDiscontinuousIterations = py::cast<Index>(d["maxDiscontinuousIterations"]);
     data.ignoreMaxDiscontinuousIterations = py::cast<bool>(d["ignoreMaxDiscontinuousIterations"]);
     data.discontinuousIterationTolerance = py::cast<Real>(d["discontinuousIterationTolerance"]);
@@ -451,6 +532,22 @@
     d["description"] = "true: compute initial accelerations from system EOM in acceleration form; NOTE that initial accelerations that are following from user functions in constraints are not considered for now! false: use zero accelerations";
     structureDict["computeInitialAccelerations"] = d;
 
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.reuseConstantMassMatrix;
+    d["type"] = "bool";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "true: the mass matrix of bodies with constant mass matrix (e.g. mass points, ANCF elements, rigid bodies with Lie group nodes and zero center of mass) is computed only once and reused in all steps; only state-dependent mass matrices (e.g. rigid bodies with Euler parameters, FFRF) are recomputed in every iteration; changing object parameters with SetObjectParameter(...) during simulation (e.g. in preStepUserFunction) signals the solver to recompute the cached mass matrix";
+    structureDict["reuseConstantMassMatrix"] = d;
+
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.matrixFreeResidual;
+    d["type"] = "bool";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "true: the term M*a in the residual is evaluated body by body (local mass matrix times local accelerations, added via local-to-global coordinate lists) without assembling the global mass matrix; the mass matrix is then only assembled into the system Jacobian; advantageous for large (sparse) systems with many residual evaluations per Jacobian update (e.g. modified Newton); overrides reuseConstantMassMatrix for the residual";
+    structureDict["matrixFreeResidual"] = d;
+
     return structureDict;
   }
   //! AUTO: write access to data structure; converting dictionary d into structure
@@ -461,6 +558,35 @@
     data.useNewmark = py::cast<bool>(d["useNewmark"]);
     data.spectralRadius = py::cast<Real>(d["spectralRadius"]);
     data.computeInitialAccelerations = py::cast<bool>(d["computeInitialAccelerations"]);
+    data.reuseConstantMassMatrix = py::cast<bool>(d["reuseConstantMassMatrix"]);
+    data.matrixFreeResidual = py::cast<bool>(d["matrixFreeResidual"]);
+  }
+  //! AUTO: read access to structure; converting into dictionary
+  py::dict GetDictionaryWithTypeInfo(const ExplicitIntegrationSettings& data) {
+    auto structureDict = py::dict();
+    auto d = py::dict(); //local dict
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.reuseConstantMassMatrix;
+    d["type"] = "bool";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "true: if all bodies have constant mass matrices, the mass matrix is only factorized once at the beginning of the simulation and after changes of object parameters with SetObjectParameter(...); false: mass matrix is computed and factorized at every stage";
+    structureDict["reuseConstantMassMatrix"] = d;
+
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.computeEndOfStepAccelerations;
+    d["type"] = "bool";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "true: accelerations are evaluated at the end of every step (for output and sensors; causes one additional RHS evaluation per step for RungeKutta4); false: accelerations of the last stage are kept";
+    structureDict["computeEndOfStepAccelerations"] = d;
+
+    return structureDict;
+  }
+  //! AUTO: write access to data structure; converting dictionary d into structure
+  void SetDictionary(ExplicitIntegrationSettings& data, const py::dict& d) {
+    data.reuseConstantMassMatrix = py::cast<bool>(d["reuseConstantMassMatrix"]);
+    data.computeEndOfStepAccelerations = py::cast<bool>(d["computeEndOfStepAccelerations"]);
   }
   //! AUTO: read access to structure; converting into dictionary
   py::dict GetDictionaryWithTypeInfo(const TimeIntegrationSettings& data) {
@@ -507,6 +633,30 @@
     d["description"] = "lower limit of time step size, before integrator stops";
     structureDict["minimumStepSize"] = d;
 
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.automaticStepSize;
+    d["type"] = "bool";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "true: generalized-alpha / Newmark step size is controlled by a local error estimate within minimumStepSize and the maximum step size (endTime-startTime)/numberOfSteps; requires adaptiveStep=True; DormandPrince45 always uses its embedded error estimate if adaptiveStep=True";
+    structureDict["automaticStepSize"] = d;
+
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.absoluteTolerance;
+    d["type"] = "UReal";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "absolute tolerance for step size control of time integration methods with error estimator (DormandPrince45 or automaticStepSize=True); only used if adaptiveStep=True";
+    structureDict["absoluteTolerance"] = d;
+
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.relativeTolerance;
+    d["type"] = "UReal";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "relative tolerance for step size control of time integration methods with error estimator (DormandPrince45 or automaticStepSize=True); only used if adaptiveStep=True";
+    structureDict["relativeTolerance"] = d;
+
     d = py::dict(); //reset local dict
     d["itemIdentifier"] = std::string(""); //identifier for item
     d["value"] = data.verboseMode;
@@ -524,6 +674,7 @@
     structureDict["verboseModeFile"] = d;
 
     structureDict["generalizedAlpha"] = GetDictionaryWithTypeInfo(data.generalizedAlpha);
+    structureDict["explicitIntegration"] = GetDictionaryWithTypeInfo(data.explicitIntegration);
     d = py::dict(); //reset local dict
     d["itemIdentifier"] = std::string(""); //identifier for item
     d["value"] = data.preStepPyExecute;
@@ -542,9 +693,13 @@
     data.numberOfSteps = py::cast<Index>(d["numberOfSteps"]);
     data.adaptiveStep = py::cast<bool>(d["adaptiveStep"]);
     data.minimumStepSize = py::cast<Real>(d["minimumStepSize"]);
+    data.automaticStepSize = py::cast<bool>(d["automaticStepSize"]);
+    data.absoluteTolerance = py::cast<Real>(d["absoluteTolerance"]);
+    data.relativeTolerance = py::cast<Real>(d["relativeTolerance"]);
     data.verboseMode = py::cast<Index>(d["verboseMode"]);
     data.verboseModeFile = py::cast<Index>(d["verboseModeFile"]);
     SetDictionary(data.generalizedAlpha, py::cast<py::dict>(d["generalizedAlpha"]));
+    SetDictionary(data.explicitIntegration, py::cast<py::dict>(d["explicitIntegration"]));
     data.preStepPyExecute = py::cast<std::string>(d["preStepPyExecute"]);
   }
   //! AUTO: read access to structure; converting into dictionary
@@ -678,7 +833,7 @@
     d["value"] = data.linearSolverType;
     d["type"] = "LinearSolverType";
     d["size"] = std::vector<int>{1};
-    d["description"] = "selection of numerical linear solver: exu.LinearSolverType.EXUdense (dense matrix inverse), exu.LinearSolverType.EigenSparse (sparse matrix LU-factorization), ... (enumeration type)";
+    d["description"] = "selection of numerical linear solver: exu.LinearSolverType.EXUdense (dense matrix inverse), exu.LinearSolverType.EigenSparse (sparse matrix LU-factorization), exu.LinearSolverType.EigenSparseSymmetric (sparse LU-factorization with preferred diagonal pivots for symmetric or saddle point matrices), exu.LinearSolverType.EigenSparseLUAMD/EigenSparseLDLT/EigenSparseLLT (AMD ordered LU, symmetric LDLT and Cholesky factorization; only available if compiled with USE_EIGEN_LGPL_SOLVERS), exu.LinearSolverType.EigenSparseIterative (BiCGSTAB with ILUT preconditioner, see newton.linearSolverTolerance), ... (enumeration type)";
     structureDict["linearSolverType"] = d;
 
     d = py::dict(); //reset local dict
@@ -726,9 +881,17 @@
     d["value"] = data.numberOfThreads;
     d["type"] = "Index";
     d["size"] = std::vector<int>{1};
-    d["description"] = "number of threads used for parallel computation (1 == scalar processing); not yet implemented (status: Nov 2019)";
+    d["description"] = "number of threads used for parallel computation (1 == scalar processing); used for multithreaded computation of object ODE2 right-hand-side (results are identical to serial computation; objects with python user functions are computed serially) and for linear solvers; requires compilation with OpenMP";
     structureDict["numberOfThreads"] = d;
 
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.batchedObjectComputation;
+    d["type"] = "bool";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "true: ObjectConnectorSpringDamper (without user function) between NodePoint/NodePoint2D nodes, MassPoint/MassPoint2D or ObjectGround markers (MarkerNodePosition, MarkerBodyPosition) are computed in batched loops over contiguous arrays in the ODE2 right-hand-side, without marker jacobians, and MassPoint/MassPoint2D objects are skipped; results are identical to per-object computation; false: all objects are computed per object";
+    structureDict["batchedObjectComputation"] = d;
+
     return structureDict;
   }
   //! AUTO: write access to data structure; converting dictionary d into structure
@@ -743,6 +906,7 @@
     data.pauseAfterEachStep = py::cast<bool>(d["pauseAfterEachStep"]);
     data.outputPrecision = py::cast<Index>(d["outputPrecision"]);
     data.numberOfThreads = py::cast<Index>(d["numberOfThreads"]);
+    data.batchedObjectComputation = py::cast<bool>(d["batchedObjectComputation"]);
   }
   //! AUTO: read access to structure; converting into dictionary
   py::dict GetDictionaryWithTypeInfo(const VSettingsGeneral& data) {
@@ -1,6 +1,6 @@
 // AUTO:  ++++++++++++++++++++++
 // AUTO:  pybind11 module includes; generated by Johannes Gerstmayr
-// AUTO:  last modified = 2020-08-25
+// AUTO:  last modified = 2026-10-16
 // AUTO:  ++++++++++++++++++++++
 
     //++++++++++++++++++++++++++++++++
@@ -22,6 +22,12 @@
         .def_readwrite("solverInformationFileName", &SolutionSettings::solverInformationFileName)
         .def_readwrite("solutionInformation", &SolutionSettings::solutionInformation)
         .def_readwrite("outputPrecision", &SolutionSettings::outputPrecision)
+        .def_readwrite("binarySolutionFile", &SolutionSettings::binarySolutionFile)
+        .def_readwrite("outputBufferSize", &SolutionSettings::outputBufferSize)
+        .def_readwrite("writeAsynchronously", &SolutionSettings::writeAsynchronously)
+        .def_readwrite("asyncBufferSize", &SolutionSettings::asyncBufferSize)
+        .def_readwrite("asyncBlockIfBufferFull", &SolutionSettings::asyncBlockIfBufferFull)
+        .def_readwrite("asyncFlushOnFinalize", &SolutionSettings::asyncFlushOnFinalize)
         .def_readwrite("recordImagesInterval", &SolutionSettings::recordImagesInterval)
         // AUTO: access functions for SolutionSettings
         .def("__repr__", [](const SolutionSettings &item) { return "<SolutionSettings:\n" + EXUstd::ToString(item) + " >"; } ) //!< AUTO: add representation for object based on ostream operator
@@ -35,6 +41,7 @@
         .def_readwrite("minimumCoordinateSize", &NumericalDifferentiationSettings::minimumCoordinateSize)
         .def_readwrite("doSystemWideDifferentiation", &NumericalDifferentiationSettings::doSystemWideDifferentiation)
         .def_readwrite("addReferenceCoordinatesToEpsilon", &NumericalDifferentiationSettings::addReferenceCoordinatesToEpsilon)
+        .def_readwrite("compressedSystemWideDifferentiation", &NumericalDifferentiationSettings::compressedSystemWideDifferentiation)
         // AUTO: access functions for NumericalDifferentiationSettings
         .def("__repr__", [](const NumericalDifferentiationSettings &item) { return "<NumericalDifferentiationSettings:\n" + EXUstd::ToString(item) + " >"; } ) //!< AUTO: add representation for object based on ostream operator
         ; // AUTO: end of class definition!!!
@@ -58,6 +65,8 @@
         .def_readwrite("maxModifiedNewtonIterations", &NewtonSettings::maxModifiedNewtonIterations)
         .def_readwrite("maxModifiedNewtonRestartIterations", &NewtonSettings::maxModifiedNewtonRestartIterations)
         .def_readwrite("maximumSolutionNorm", &NewtonSettings::maximumSolutionNorm)
+        .def_readwrite("linearSolverTolerance", &NewtonSettings::linearSolverTolerance)
+        .def_readwrite("linearSolverMaxIterations", &NewtonSettings::linearSolverMaxIterations)
         .def_readwrite("maxDiscontinuousIterations", &NewtonSettings::maxDiscontinuousIterations)
         .def_readwrite("ignoreMaxDiscontinuousIterations", &NewtonSettings::ignoreMaxDiscontinuousIterations)
         .def_readwrite("discontinuousIterationTolerance", &NewtonSettings::discontinuousIterationTolerance)
@@ -76,10 +85,22 @@
         .def_readwrite("useNewmark", &GeneralizedAlphaSettings::useNewmark)
         .def_readwrite("spectralRadius", &GeneralizedAlphaSettings::spectralRadius)
         .def_readwrite("computeInitialAccelerations", &GeneralizedAlphaSettings::computeInitialAccelerations)
+        .def_readwrite("reuseConstantMassMatrix", &GeneralizedAlphaSettings::reuseConstantMassMatrix)
+        .def_readwrite("matrixFreeResidual", &GeneralizedAlphaSettings::matrixFreeResidual)
         // AUTO: access functions for GeneralizedAlphaSettings
         .def("__repr__", [](const GeneralizedAlphaSettings &item) { return "<GeneralizedAlphaSettings:\n" + EXUstd::ToString(item) + " >"; } ) //!< AUTO: add representation for object based on ostream operator
         ; // AUTO: end of class definition!!!
 
+    //++++++++++++++++++++++++++++++++
+    //++++++++++++++++++++++++++++++++
+    py::class_<ExplicitIntegrationSettings>(m, "ExplicitIntegrationSettings") // AUTO: 
+        .def(py::init<>())
+        .def_readwrite("reuseConstantMassMatrix", &ExplicitIntegrationSettings::reuseConstantMassMatrix)
+        .def_readwrite("computeEndOfStepAccelerations", &ExplicitIntegrationSettings::computeEndOfStepAccelerations)
+        // AUTO: access functions for ExplicitIntegrationSettings
+        .def("__repr__", [](const ExplicitIntegrationSettings &item) { return "<ExplicitIntegrationSettings:\n" + EXUstd::ToString(item) + " >"; } ) //!< AUTO: add representation for object based on ostream operator
+        ; // AUTO: end of class definition!!!
+
     //++++++++++++++++++++++++++++++++
     //++++++++++++++++++++++++++++++++
     py::class_<TimeIntegrationSettings>(m, "TimeIntegrationSettings") // AUTO: 
@@ -90,9 +111,13 @@
         .def_readwrite("numberOfSteps", &TimeIntegrationSettings::numberOfSteps)
         .def_readwrite("adaptiveStep", &TimeIntegrationSettings::adaptiveStep)
         .def_readwrite("minimumStepSize", &TimeIntegrationSettings::minimumStepSize)
+        .def_readwrite("automaticStepSize", &TimeIntegrationSettings::automaticStepSize)
+        .def_readwrite("absoluteTolerance", &TimeIntegrationSettings::absoluteTolerance)
+        .def_readwrite("relativeTolerance", &TimeIntegrationSettings::relativeTolerance)
         .def_readwrite("verboseMode", &TimeIntegrationSettings::verboseMode)
         .def_readwrite("verboseModeFile", &TimeIntegrationSettings::verboseModeFile)
         .def_readwrite("generalizedAlpha", &TimeIntegrationSettings::generalizedAlpha)
+        .def_readwrite("explicitIntegration", &TimeIntegrationSettings::explicitIntegration)
         .def_readwrite("preStepPyExecute", &TimeIntegrationSettings::preStepPyExecute)
         // AUTO: access functions for TimeIntegrationSettings
         .def("__repr__", [](const TimeIntegrationSettings &item) { return "<TimeIntegrationSettings:\n" + EXUstd::ToString(item) + " >"; } ) //!< AUTO: add representation for object based on ostream operator
@@ -133,6 +158,7 @@
         .def_readwrite("pauseAfterEachStep", &SimulationSettings::pauseAfterEachStep)
         .def_readwrite("outputPrecision", &SimulationSettings::outputPrecision)
         .def_readwrite("numberOfThreads", &SimulationSettings::numberOfThreads)
+        .def_readwrite("batchedObjectComputation", &SimulationSettings::batchedObjectComputation)
         // AUTO: access functions for SimulationSettings
         .def("__repr__", [](const SimulationSettings &item) { return "<SimulationSettings:\n" + EXUstd::ToString(item) + " >"; } ) //!< AUTO: add representation for object based on ostream operator
         .def("GetDictionaryWithTypeInfo", [](const SimulationSettings &item) { return EPyUtils::GetDictionaryWithTypeInfo(item); }) //!< AUTO: add read as dictionary with type information access
@@ -368,6 +394,8 @@
         .def_readwrite("useTimer", &CSolverTimer::useTimer)
         .def_readwrite("total", &CSolverTimer::total)
         .def_readwrite("factorization", &CSolverTimer::factorization)
+        .def_readwrite("factorizationSymbolic", &CSolverTimer::factorizationSymbolic)
+        .def_readwrite("linearSolverType", &CSolverTimer::linearSolverType)
         .def_readwrite("newtonIncrement", &CSolverTimer::newtonIncrement)
         .def_readwrite("integrationFormula", &CSolverTimer::integrationFormula)
         .def_readwrite("ODE2RHS", &CSolverTimer::ODE2RHS)
@@ -380,6 +408,7 @@
         .def_readwrite("reactionForces", &CSolverTimer::reactionForces)
         .def_readwrite("postNewton", &CSolverTimer::postNewton)
         .def_readwrite("writeSolution", &CSolverTimer::writeSolution)
+        .def_readwrite("writeSolutionAsync", &CSolverTimer::writeSolutionAsync)
         .def_readwrite("overhead", &CSolverTimer::overhead)
         .def_readwrite("python", &CSolverTimer::python)
         .def_readwrite("visualization", &CSolverTimer::visualization)
@@ -402,6 +431,7 @@
         .def_readwrite("nData", &SolverLocalData::nData)
         .def_readwrite("nSys", &SolverLocalData::nSys)
         .def_readwrite("startAE", &SolverLocalData::startAE)
+        .def_readwrite("constantMassMatrixComputed", &SolverLocalData::constantMassMatrixComputed)
         .def_readwrite("systemResidual", &SolverLocalData::systemResidual)
         .def_readwrite("newtonSolution", &SolverLocalData::newtonSolution)
         .def_readwrite("tempODE2", &SolverLocalData::tempODE2)
@@ -424,6 +454,7 @@
         .def_readwrite("maxStepSize", &SolverIterationData::maxStepSize)
         .def_readwrite("minStepSize", &SolverIterationData::minStepSize)
         .def_readwrite("currentStepSize", &SolverIterationData::currentStepSize)
+        .def_readwrite("recommendedStepSize", &SolverIterationData::recommendedStepSize)
         .def_readwrite("numberOfSteps", &SolverIterationData::numberOfSteps)
         .def_readwrite("currentStepIndex", &SolverIterationData::currentStepIndex)
         .def_readwrite("adaptiveStep", &SolverIterationData::adaptiveStep)
@@ -435,7 +466,19 @@
         .def_readwrite("newtonStepsCount", &SolverIterationData::newtonStepsCount)
         .def_readwrite("newtonJacobiCount", &SolverIterationData::newtonJacobiCount)
         .def_readwrite("rejectedModifiedNewtonSteps", &SolverIterationData::rejectedModifiedNewtonSteps)
+        .def_readwrite("linearSolverIterationsCount", &SolverIterationData::linearSolverIterationsCount)
+        .def_readwrite("linearSolverFailedCount", &SolverIterationData::linearSolverFailedCount)
         .def_readwrite("discontinuousIterationsCount", &SolverIterationData::discontinuousIterationsCount)
+        .def_readwrite("rejectedSteps", &SolverIterationData::rejectedSteps)
+        .def_readwrite("smallestStepSize", &SolverIterationData::smallestStepSize)
+        .def_readwrite("largestStepSize", &SolverIterationData::largestStepSize)
+        .def_readwrite("allocationsCount", &SolverIterationData::allocationsCount)
+        .def_readwrite("maxStepAllocations", &SolverIterationData::maxStepAllocations)
+        .def_readwrite("allocationsResidual", &SolverIterationData::allocationsResidual)
+        .def_readwrite("allocationsJacobian", &SolverIterationData::allocationsJacobian)
+        .def_readwrite("allocationsFactorization", &SolverIterationData::allocationsFactorization)
+        .def_readwrite("allocationsOutput", &SolverIterationData::allocationsOutput)
+        .def_readwrite("allocationsSensors", &SolverIterationData::allocationsSensors)
         // AUTO: access functions for SolverIterationData
         .def("ToString", &SolverIterationData::ToString, py::return_value_policy::copy, "convert iteration statistics to string; used for displayStatistics option")
         .def("__repr__", [](const SolverIterationData &item) { return "<SolverIterationData:\n" + EXUstd::ToString(item) + " >"; } ) //!< AUTO: add representation for object based on ostream operator
@@ -4,7 +4,7 @@
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2020-08-25 (last modfied)
+* @date         AUTO: 2026-10-16 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -42,6 +42,12 @@ public: // AUTO:
   std::string solverInformationFileName;          //!< AUTO: filename and (relative) path of text file showing detailed information during solving; detail level according to yourSolver.verboseModeFile; if solutionSettings.appendToFile is true, the information is appended in every solution step; directory will be created if it does not exist
   std::string solutionInformation;                //!< AUTO: special information added to header of solution file (e.g. parameters and settings, modes, ...)
   Index outputPrecision;                          //!< AUTO: precision for floating point numbers written to solution and sensor files
+  bool binarySolutionFile;                        //!< AUTO: flag (true/false); if true, solution and sensor files are written in binary format: a self-describing header (see LoadBinaryFile(...) in exudyn.utilities) followed by rows of raw little-endian Real values; the data section can be memory-mapped; outputPrecision and writeFileFooter have no effect in binary mode; the binary header is always written (writeFileHeader only controls the embedded text); with appendToFile, rows are appended to an existing binary file without a second header, if the existing header has the same layout (otherwise an error is raised and the file is not written)
+  Index outputBufferSize;                         //!< AUTO: size of write buffer in bytes, which is used for the solution file and for every sensor file; larger buffers reduce the number of file system calls for large systems; values below 4096 are increased to 4096
+  bool writeAsynchronously;                       //!< AUTO: flag (true/false); if true, solution and sensor files are written by a background writer thread: the solver only copies the exported values into a ring buffer and continues, while formatting and file output are done in parallel; time of writer thread is shown as writeSolutionAsync in timer statistics
+  Index asyncBufferSize;                          //!< AUTO: size of ring buffer in bytes for asynchronous output (writeAsynchronously); it is enlarged automatically to hold at least two solution rows
+  bool asyncBlockIfBufferFull;                    //!< AUTO: flag (true/false) for asynchronous output; if true, the solver waits until the writer thread provides space in a full ring buffer (no data is lost); if false, rows are dropped if the ring buffer is full and the number of dropped rows is reported at the end of simulation
+  bool asyncFlushOnFinalize;                      //!< AUTO: flag (true/false) for asynchronous output; if true, the solver waits at the end of simulation until all buffered rows are written; if false, rows which are not yet written at the end of simulation are discarded (e.g. to stop quickly)
   Real recordImagesInterval;                      //!< AUTO: record frames (images) during solving: amount of time to wait until next image (frame) is recorded; set recordImages = -1. if no images shall be recorded; set, e.g., recordImages = 0.01 to record an image every 10 milliseconds (requires that the time steps / load steps are sufficiently small!); for file names, etc., see VisualizationSettings.exportImages
 
 
@@ -64,6 +70,12 @@ public: // AUTO:
     coordinatesSolutionFileName = "coordinatesSolution.txt";
     solverInformationFileName = "solverInformation.txt";
     outputPrecision = 10;
+    binarySolutionFile = false;
+    outputBufferSize = 65536;
+    writeAsynchronously = false;
+    asyncBufferSize = 16777216;
+    asyncBlockIfBufferFull = true;
+    asyncFlushOnFinalize = true;
     recordImagesInterval = -1.;
   };
 
@@ -88,6 +100,12 @@ public: // AUTO:
     os << "  solverInformationFileName = " << solverInformationFileName << "\n";
     os << "  solutionInformation = " << solutionInformation << "\n";
     os << "  outputPrecision = " << outputPrecision << "\n";
+    os << "  binarySolutionFile = " << binarySolutionFile << "\n";
+    os << "  outputBufferSize = " << outputBufferSize << "\n";
+    os << "  writeAsynchronously = " << writeAsynchronously << "\n";
+    os << "  asyncBufferSize = " << asyncBufferSize << "\n";
+    os << "  asyncBlockIfBufferFull = " << asyncBlockIfBufferFull << "\n";
+    os << "  asyncFlushOnFinalize = " << asyncFlushOnFinalize << "\n";
     os << "  recordImagesInterval = " << recordImagesInterval << "\n";
     os << "\n";
   }
@@ -107,7 +125,7 @@ public: // AUTO:
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2020-08-25 (last modfied)
+* @date         AUTO: 2026-10-16 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -129,6 +147,7 @@ public: // AUTO:
   Real minimumCoordinateSize;                     //!< AUTO: minimum size of coordinates in relative differentiation parameter
   bool doSystemWideDifferentiation;               //!< AUTO: true: system wide differentiation (e.g. all ODE2 equations w.r.t. all ODE2 coordinates); false: only local (object) differentiation
   bool addReferenceCoordinatesToEpsilon;          //!< AUTO: true: for the size estimation of the differentiation parameter, the reference coordinate \f$q^{Ref}_i\f$ is added to ODE2 coordinates --> see; false: only the current coordinate is used for size estimation of the differentiation parameter
+  bool compressedSystemWideDifferentiation;       //!< AUTO: true: system wide differentiation (doSystemWideDifferentiation) perturbs all coordinates at once which do not share an object or node (column coloring, Curtis-Powell-Reed); needs a few ODE2RHS evaluations instead of one per coordinate for large systems with local coupling; only valid if forces of objects and loads only depend on coordinates of the object or load (not for user functions using coordinates of other items)
 
 
 public: // AUTO: 
@@ -139,6 +158,7 @@ public: // AUTO:
     minimumCoordinateSize = 1e-2;
     doSystemWideDifferentiation = false;
     addReferenceCoordinatesToEpsilon = false;
+    compressedSystemWideDifferentiation = false;
   };
 
   // AUTO: access functions
@@ -150,6 +170,7 @@ public: // AUTO:
     os << "  minimumCoordinateSize = " << minimumCoordinateSize << "\n";
     os << "  doSystemWideDifferentiation = " << doSystemWideDifferentiation << "\n";
     os << "  addReferenceCoordinatesToEpsilon = " << addReferenceCoordinatesToEpsilon << "\n";
+    os << "  compressedSystemWideDifferentiation = " << compressedSystemWideDifferentiation << "\n";
     os << "\n";
   }
 
@@ -168,7 +189,7 @@ public: // AUTO:
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2020-08-25 (last modfied)
+* @date         AUTO: 2026-10-16 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -201,6 +222,8 @@ public: // AUTO:
   Index maxModifiedNewtonIterations;              //!< AUTO: maximum number of iterations for modified Newton (without Jacobian update); after that number of iterations, the modified Newton method gets a jacobian update and is further iterated
   Index maxModifiedNewtonRestartIterations;       //!< AUTO: maximum number of iterations for modified Newton after aJacobian update; after that number of iterations, the full Newton method is started for this step
   Real maximumSolutionNorm;                       //!< AUTO: this is the maximum allowed value for solutionU.L2NormSquared() which is the square of the square norm (value=\f$u_1^2\f$+\f$u_2^2\f$+...), and solutionV/A...; if the norm of solution vectors are larger, Newton method is stopped; the default value is chosen such that it would still work for single precision numbers (float)
+  Real linearSolverTolerance;                     //!< AUTO: relative residual tolerance (\f$|\mathbf{A} \Delta \mathbf{q} - \mathbf{r}|/|\mathbf{r}|\f$) for iterative linear solver (linearSolverType = EigenSparseIterative) used to compute Newton increments; 0 ... use machine precision
+  Index linearSolverMaxIterations;                //!< AUTO: maximum number of iterations of iterative linear solver (linearSolverType = EigenSparseIterative) per Newton increment; 0 ... use 2 times number of unknowns; if the tolerance is not reached, the Newton iteration is repeated with updated Jacobian (and preconditioner); if the tolerance is still not reached, the linear solver fails, which leads to step reduction (if possible) or stops the solver
   Index maxDiscontinuousIterations;               //!< AUTO: maximum number of discontinuous (post Newton) iterations
   bool ignoreMaxDiscontinuousIterations;          //!< AUTO: continue solver if maximum number of discontinuous (post Newton) iterations is reached (ignore tolerance)
   Real discontinuousIterationTolerance;           //!< AUTO: absolute tolerance for discontinuous (post Newton) iterations; the errors represent absolute residuals and can be quite high
@@ -225,6 +248,8 @@ public: // AUTO:
     maxModifiedNewtonIterations = 8;
     maxModifiedNewtonRestartIterations = 7;
     maximumSolutionNorm = 1e38;
+    linearSolverTolerance = 1e-10;
+    linearSolverMaxIterations = 0;
     maxDiscontinuousIterations = 5;
     ignoreMaxDiscontinuousIterations = true;
     discontinuousIterationTolerance = 1;
@@ -251,6 +276,8 @@ public: // AUTO:
     os << "  maxModifiedNewtonIterations = " << maxModifiedNewtonIterations << "\n";
     os << "  maxModifiedNewtonRestartIterations = " << maxModifiedNewtonRestartIterations << "\n";
     os << "  maximumSolutionNorm = " << maximumSolutionNorm << "\n";
+    os << "  linearSolverTolerance = " << linearSolverTolerance << "\n";
+    os << "  linearSolverMaxIterations = " << linearSolverMaxIterations << "\n";
     os << "  maxDiscontinuousIterations = " << maxDiscontinuousIterations << "\n";
     os << "  ignoreMaxDiscontinuousIterations = " << ignoreMaxDiscontinuousIterations << "\n";
     os << "  discontinuousIterationTolerance = " << discontinuousIterationTolerance << "\n";
@@ -273,7 +300,7 @@ public: // AUTO:
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2020-08-25 (last modfied)
+* @date         AUTO: 2026-10-16 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -297,6 +324,8 @@ public: // AUTO:
   bool useNewmark;                                //!< AUTO: if true, use Newmark method with beta and gamma instead of generalized-Alpha
   Real spectralRadius;                            //!< AUTO: spectral radius for Generalized-alpha solver; set this value to 1 for no damping or to 0 < spectralRadius < 1 for damping of high-frequency dynamics; for position-level constraints (index 3), spectralRadius must be < 1
   bool computeInitialAccelerations;               //!< AUTO: true: compute initial accelerations from system EOM in acceleration form; NOTE that initial accelerations that are following from user functions in constraints are not considered for now! false: use zero accelerations
+  bool reuseConstantMassMatrix;                   //!< AUTO: true: the mass matrix of bodies with constant mass matrix (e.g. mass points, ANCF elements, rigid bodies with Lie group nodes and zero center of mass) is computed only once and reused in all steps; only state-dependent mass matrices (e.g. rigid bodies with Euler parameters, FFRF) are recomputed in every iteration; changing object parameters with SetObjectParameter(...) during simulation (e.g. in preStepUserFunction) signals the solver to recompute the cached mass matrix
+  bool matrixFreeResidual;                        //!< AUTO: true: the term M*a in the residual is evaluated body by body (local mass matrix times local accelerations, added via local-to-global coordinate lists) without assembling the global mass matrix; the mass matrix is then only assembled into the system Jacobian; advantageous for large (sparse) systems with many residual evaluations per Jacobian update (e.g. modified Newton); overrides reuseConstantMassMatrix for the residual
 
 
 public: // AUTO: 
@@ -309,6 +338,8 @@ public: // AUTO:
     useNewmark = false;
     spectralRadius = 0.9;
     computeInitialAccelerations = true;
+    reuseConstantMassMatrix = true;
+    matrixFreeResidual = false;
   };
 
   // AUTO: access functions
@@ -322,6 +353,8 @@ public: // AUTO:
     os << "  useNewmark = " << useNewmark << "\n";
     os << "  spectralRadius = " << spectralRadius << "\n";
     os << "  computeInitialAccelerations = " << computeInitialAccelerations << "\n";
+    os << "  reuseConstantMassMatrix = " << reuseConstantMassMatrix << "\n";
+    os << "  matrixFreeResidual = " << matrixFreeResidual << "\n";
     os << "\n";
   }
 
@@ -334,13 +367,68 @@ public: // AUTO:
 };
 
 
+/** ***********************************************************************************************
+* @class        ExplicitIntegrationSettings
+* @brief        Settings for explicit Runge-Kutta time integration methods (RungeKutta4, DormandPrince45).
+*
+* @author       AUTO: Gerstmayr Johannes
+* @date         AUTO: 2019-07-01 (generated)
+* @date         AUTO: 2026-10-16 (last modfied)
+*
+* @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
+* @note         Bug reports, support and further information:
+                - email: johannes.gerstmayr@uibk.ac.at
+                - weblink: missing
+                
+************************************************************************************************ **/
+#include <ostream>
+
+#include "Utilities/ReleaseAssert.h"
+#include "Utilities/BasicDefinitions.h"
+#include "Main/OutputVariable.h"
+#include "Linalg/BasicLinalg.h"
+
+class ExplicitIntegrationSettings // AUTO: 
+{
+public: // AUTO: 
+  bool reuseConstantMassMatrix;                   //!< AUTO: true: if all bodies have constant mass matrices, the mass matrix is only factorized once at the beginning of the simulation and after changes of object parameters with SetObjectParameter(...); false: mass matrix is computed and factorized at every stage
+  bool computeEndOfStepAccelerations;             //!< AUTO: true: accelerations are evaluated at the end of every step (for output and sensors; causes one additional RHS evaluation per step for RungeKutta4); false: accelerations of the last stage are kept
+
+
+public: // AUTO: 
+  //! AUTO: default constructor with parameter initialization
+  ExplicitIntegrationSettings()
+  {
+    reuseConstantMassMatrix = true;
+    computeEndOfStepAccelerations = true;
+  };
+
+  // AUTO: access functions
+  //! AUTO: print function used in ostream operator (print is virtual and can thus be overloaded)
+  virtual void Print(std::ostream& os) const
+  {
+    os << "ExplicitIntegrationSettings" << ":\n";
+    os << "  reuseConstantMassMatrix = " << reuseConstantMassMatrix << "\n";
+    os << "  computeEndOfStepAccelerations = " << computeEndOfStepAccelerations << "\n";
+    os << "\n";
+  }
+
+  friend std::ostream& operator<<(std::ostream& os, const ExplicitIntegrationSettings& object)
+  {
+    object.Print(os);
+    return os;
+  }
+
+};
+
+
 /** ***********************************************************************************************
 * @class        TimeIntegrationSettings
 * @brief        General parameters used in time integration; specific parameters are provided in the according solver settings, e.g. for generalizedAlpha.
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2020-08-25 (last modfied)
+* @date         AUTO: 2026-10-16 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -364,9 +452,13 @@ public: // AUTO:
   Index numberOfSteps;                            //!< AUTO: number of steps in time integration; stepsize is computed from (endTime-startTime)/numberOfSteps
   bool adaptiveStep;                              //!< AUTO: true: use step reduction if step fails; false: constant step size
   Real minimumStepSize;                           //!< AUTO: lower limit of time step size, before integrator stops
+  bool automaticStepSize;                         //!< AUTO: true: generalized-alpha / Newmark step size is controlled by a local error estimate within minimumStepSize and the maximum step size (endTime-startTime)/numberOfSteps; requires adaptiveStep=True; DormandPrince45 always uses its embedded error estimate if adaptiveStep=True
+  Real absoluteTolerance;                         //!< AUTO: absolute tolerance for step size control of time integration methods with error estimator (DormandPrince45 or automaticStepSize=True); only used if adaptiveStep=True
+  Real relativeTolerance;                         //!< AUTO: relative tolerance for step size control of time integration methods with error estimator (DormandPrince45 or automaticStepSize=True); only used if adaptiveStep=True
   Index verboseMode;                              //!< AUTO: 0 ... no output, 1 ... show short step information every 2 seconds (error), 2 ... show every step information, 3 ... show also solution vector, 4 ... show also mass matrix and jacobian (implicit methods), 5 ... show also Jacobian inverse (implicit methods)
   Index verboseModeFile;                          //!< AUTO: same behaviour as verboseMode, but outputs all solver information to file
   GeneralizedAlphaSettings generalizedAlpha;      //!< AUTO: parameters for generalized-alpha, implicit trapezoidal rule or Newmark (options only apply for these methods)
+  ExplicitIntegrationSettings explicitIntegration;//!< AUTO: parameters for explicit Runge-Kutta methods (options only apply for these methods)
   std::string preStepPyExecute;                   //!< AUTO: DEPRECATED, use preStepFunction in simulation settings; Python code to be executed prior to every step and after last step, e.g. for postprocessing
 
 
@@ -379,6 +471,9 @@ public: // AUTO:
     numberOfSteps = 100;
     adaptiveStep = true;
     minimumStepSize = 1e-8;
+    automaticStepSize = false;
+    absoluteTolerance = 1e-8;
+    relativeTolerance = 1e-8;
     verboseMode = 0;
     verboseModeFile = 0;
   };
@@ -394,9 +489,13 @@ public: // AUTO:
     os << "  numberOfSteps = " << numberOfSteps << "\n";
     os << "  adaptiveStep = " << adaptiveStep << "\n";
     os << "  minimumStepSize = " << minimumStepSize << "\n";
+    os << "  automaticStepSize = " << automaticStepSize << "\n";
+    os << "  absoluteTolerance = " << absoluteTolerance << "\n";
+    os << "  relativeTolerance = " << relativeTolerance << "\n";
     os << "  verboseMode = " << verboseMode << "\n";
     os << "  verboseModeFile = " << verboseModeFile << "\n";
     os << "  generalizedAlpha = " << generalizedAlpha << "\n";
+    os << "  explicitIntegration = " << explicitIntegration << "\n";
     os << "  preStepPyExecute = " << preStepPyExecute << "\n";
     os << "\n";
   }
@@ -416,7 +515,7 @@ public: // AUTO:
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2020-08-25 (last modfied)
+* @date         AUTO: 2026-10-16 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -502,7 +601,7 @@ public: // AUTO:
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2020-08-25 (last modfied)
+* @date         AUTO: 2026-10-16 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -523,13 +622,14 @@ public: // AUTO:
   TimeIntegrationSettings timeIntegration;        //!< AUTO: time integration parameters
   SolutionSettings solutionSettings;              //!< AUTO: settings for solution files
   StaticSolverSettings staticSolver;              //!< AUTO: static solver parameters
-  LinearSolverType linearSolverType;              //!< AUTO: selection of numerical linear solver: exu.LinearSolverType.EXUdense (dense matrix inverse), exu.LinearSolverType.EigenSparse (sparse matrix LU-factorization), ... (enumeration type)
+  LinearSolverType linearSolverType;              //!< AUTO: selection of numerical linear solver: exu.LinearSolverType.EXUdense (dense matrix inverse), exu.LinearSolverType.EigenSparse (sparse matrix LU-factorization), exu.LinearSolverType.EigenSparseSymmetric (sparse LU-factorization with preferred diagonal pivots for symmetric or saddle point matrices), exu.LinearSolverType.EigenSparseLUAMD/EigenSparseLDLT/EigenSparseLLT (AMD ordered LU, symmetric LDLT and Cholesky factorization; only available if compiled with USE_EIGEN_LGPL_SOLVERS), exu.LinearSolverType.EigenSparseIterative (BiCGSTAB with ILUT preconditioner, see newton.linearSolverTolerance), ... (enumeration type)
   bool cleanUpMemory;                             //!< AUTO: true: solvers will free memory at exit (recommended for large systems); false: keep allocated memory for repeated computations to increase performance
   bool displayStatistics;                         //!< AUTO: display general computation information at end of time step (steps, iterations, function calls, step rejections, ...
   bool displayComputationTime;                    //!< AUTO: display computation time statistics at end of solving
   bool pauseAfterEachStep;                        //!< AUTO: pause after every time step or static load step(user press SPACE)
   Index outputPrecision;                          //!< AUTO: precision for floating point numbers written to console; e.g. values written by solver
-  Index numberOfThreads;                          //!< AUTO: number of threads used for parallel computation (1 == scalar processing); not yet implemented (status: Nov 2019)
+  Index numberOfThreads;                          //!< AUTO: number of threads used for parallel computation (1 == scalar processing); used for multithreaded computation of object ODE2 right-hand-side (results are identical to serial computation; objects with python user functions are computed serially) and for linear solvers; requires compilation with OpenMP
+  bool batchedObjectComputation;                  //!< AUTO: true: ObjectConnectorSpringDamper (without user function) between NodePoint/NodePoint2D nodes, MassPoint/MassPoint2D or ObjectGround markers (MarkerNodePosition, MarkerBodyPosition) are computed in batched loops over contiguous arrays in the ODE2 right-hand-side, without marker jacobians, and MassPoint/MassPoint2D objects are skipped; results are identical to per-object computation; false: all objects are computed per object
 
 
 public: // AUTO: 
@@ -543,6 +643,7 @@ public: // AUTO:
     pauseAfterEachStep = false;
     outputPrecision = 6;
     numberOfThreads = 1;
+    batchedObjectComputation = true;
   };
 
   // AUTO: access functions
@@ -560,6 +661,7 @@ public: // AUTO:
     os << "  pauseAfterEachStep = " << pauseAfterEachStep << "\n";
     os << "  outputPrecision = " << outputPrecision << "\n";
     os << "  numberOfThreads = " << numberOfThreads << "\n";
+    os << "  batchedObjectComputation = " << batchedObjectComputation << "\n";
     os << "\n";
   }
 
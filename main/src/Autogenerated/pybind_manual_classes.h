@@ -1,6 +1,6 @@
 // AUTO:  ++++++++++++++++++++++
 // AUTO:  pybind11 manual module includes; generated by Johannes Gerstmayr
-// AUTO:  last modified = 2020-09-08
+// AUTO:  last modified = 2026-10-16
 // AUTO:  ++++++++++++++++++++++
 
 //        pybinding to enum classes:
@@ -49,6 +49,11 @@
 		.value("_None", LinearSolverType::_None)    //no value; used, e.g., if no solver is selected
 		.value("EXUdense", LinearSolverType::EXUdense)    //use dense matrices and according solvers for densly populated matrices (usually the CPU time grows cubically with the number of unknowns)
 		.value("EigenSparse", LinearSolverType::EigenSparse)    //use sparse matrices and according solvers; additional overhead for very small systems; specifically, memory allocation is performed during a factorization process
+		.value("EigenSparseSymmetric", LinearSolverType::EigenSparseSymmetric)    //use sparse matrices and Eigen SparseLU in symmetric mode, preferring diagonal pivots; for symmetric or symmetric indefinite (saddle point) systems
+		.value("EigenSparseLUAMD", LinearSolverType::EigenSparseLUAMD)    //use sparse matrices and Eigen SparseLU with approximate minimum degree ordering; only available if compiled with USE_EIGEN_LGPL_SOLVERS
+		.value("EigenSparseLDLT", LinearSolverType::EigenSparseLDLT)    //use sparse matrices and Eigen SimplicialLDLT for symmetric matrices (no pivoting, lower triangular part used; symmetry is checked in every factorization); only available if compiled with USE_EIGEN_LGPL_SOLVERS
+		.value("EigenSparseLLT", LinearSolverType::EigenSparseLLT)    //use sparse matrices and Eigen SimplicialLLT for symmetric positive or negative definite matrices (lower triangular part used; symmetry is checked in every factorization); only available if compiled with USE_EIGEN_LGPL_SOLVERS
+		.value("EigenSparseIterative", LinearSolverType::EigenSparseIterative)    //use sparse matrices and iterative Eigen BiCGSTAB solver with incomplete LU (ILUT) preconditioner; the preconditioner is only recomputed at Jacobian updates and reused during modified Newton iterations; see NewtonSettings.linearSolverTolerance
 		.export_values();
 
 
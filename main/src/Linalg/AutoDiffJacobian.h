@@ -0,0 +1,74 @@
+/** ***********************************************************************************************
+* @brief		Jacobians of local residual functions by forward mode automatic differentiation
+* @details		Details:
+* 				- objects and connectors opt into automatic differentiation by implementing their residual
+*				  (ODE2 RHS or force law) as a template function of TReal
+*				- the template is evaluated once with TReal=AutoDiff<2*n>, seeding n coordinates and n velocities;
+*				  numerical differentiation needs 2*n+1 evaluations and has truncation errors
+*				- uses ngstd::AutoDiff from ngs-core-master (Netgen/NGSolve)
+*
+* @author		agent
+* @date			2026-10-16
+*
+* @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+* @note			Bug reports, support and further information:
+* 				- email: johannes.gerstmayr@uibk.ac.at
+* 				- weblink: missing
+*
+*
+* *** Example code ***
+*
+* @code{.cpp}
+*	//jacobian of f(u,v) = [k*u^2 + d*v]:
+*	ResizableMatrix jac, jac_t;
+*	EXUmath::AutoDiffJacobian<1, 1>(ConstSizeVector<1>({ u }), ConstSizeVector<1>({ v }),
+*		[&](auto& f, const auto& q, const auto& q_t) { f[0] = k * q[0] * q[0] + d * q_t[0]; }, jac, jac_t);
+* @endcode
+************************************************************************************************ */
+#ifndef AUTODIFFJACOBIAN__H
+#define AUTODIFFJACOBIAN__H
+
+#include <ostream> //for autodiff
+#include "ngs-core-master/autodiff.hpp"
+
+#include "Linalg/ConstSizeVector.h"
+#include "Linalg/ConstSizeMatrix.h"
+#include "Linalg/ResizableMatrix.h"
+
+namespace EXUmath {
+
+	//! compute jacobian of residual f(q, q_t) w.r.t. q (jacobian) and w.r.t. q_t (jacobian_t) at (q0, q0_t) by forward mode automatic differentiation;
+	//! residualFunction(f, q, q_t) receives ConstSizeVectorBase<AutoDiff<2*n,Real>, ...> vectors (f has nResidual items); use a generic lambda calling a templated member function;
+	//! jacobian and jacobian_t are resized to nResidual x n; use ConstSizeMatrix for small jacobians to avoid memory allocation
+	template<Index n, Index nResidual, class TFunction>
+	void AutoDiffJacobian(const ConstSizeVector<n>& q0, const ConstSizeVector<n>& q0_t, const TFunction& residualFunction,
+		Matrix& jacobian, Matrix& jacobian_t)
+	{
+		typedef ngstd::AutoDiff<2 * n, Real> TReal;
+
+		ConstSizeVectorBase<TReal, n> q;
+		ConstSizeVectorBase<TReal, n> q_t;
+		for (Index i = 0; i < n; i++)
+		{
+			q[i] = TReal(q0[i], (int)i);			//derivatives w.r.t. coordinates in first block
+			q_t[i] = TReal(q0_t[i], (int)(i + n));	//derivatives w.r.t. velocities in second block
+		}
+
+		ConstSizeVectorBase<TReal, nResidual> f;
+		residualFunction(f, q, q_t);
+
+		jacobian.SetNumberOfRowsAndColumns(nResidual, n);
+		jacobian_t.SetNumberOfRowsAndColumns(nResidual, n);
+		for (Index i = 0; i < nResidual; i++)
+		{
+			for (Index j = 0; j < n; j++)
+			{
+				jacobian(i, j) = f[i].DValue((int)j);
+				jacobian_t(i, j) = f[i].DValue((int)(j + n));
+			}
+		}
+	}
+
+} //namespace EXUmath
+
+#endif
@@ -16,13 +16,46 @@
 #include "Utilities/TimerStructure.h" //for local CPU time measurement
 
 
-	//! factorize matrix (invert, SparseLU, etc.); 0=success
+//! factorize matrix with LU decomposition (partial pivoting); matrix is not modified; 0=success, 1=matrix is singular (zero pivot)
 Index GeneralMatrixEXUdense::Factorize()
 {
-	Index rv = !matrix.Invert();
-	if (!rv) { SetMatrixIsFactorized(true); }
-	else { SetMatrixIsFactorized(false); }
-	return rv;
+	SetMatrixIsFactorized(false);
+	Index n = matrix.NumberOfRows();
+	CHECKandTHROW(n == matrix.NumberOfColumns(), "GeneralMatrixEXUdense::Factorize(): only valid for quadratic matrices");
+	if (n == 0) { SetMatrixIsFactorized(true); return 0; } //no need to factorize; but this is no error!
+
+#ifdef USE_EIGEN
+	luFactorization.compute(Eigen::Map<const EigenDenseMatrixRowMajor>(matrix.GetDataPointer(), n, n));
+
+	//PartialPivLU does not stop at zero pivots ==> check for exactly zero pivot (same criterion as in MatrixBase::Invert())
+	const EigenDenseMatrix& lu = luFactorization.matrixLU();
+	for (Index i = 0; i < n; i++)
+	{
+		if (lu(i, i) == 0.) { return 1; }
+	}
+	SetMatrixIsFactorized(true);
+	return 0;
+#else
+	CHECKandTHROWstring("GeneralMatrixEXUdense::Factorize(): requires USE_EIGEN");
+	return 1;
+#endif
+}
+
+//! solve with LU factorization computed in Factorize(); no memory allocation, if solution has already size of rhs
+Index GeneralMatrixEXUdense::Solve(const Vector& rhs, Vector& solution)
+{
+	if (!IsMatrixIsFactorized()) { SysError("GeneralMatrixEXUdense::Solve(...): matrix is not factorized!"); }
+	CHECKandTHROW(rhs.NumberOfItems() == NumberOfRows(), "GeneralMatrixEXUdense::Solve(...): size mismatch");
+	CHECKandTHROW(rhs.GetDataPointer() != solution.GetDataPointer() || rhs.NumberOfItems() == 0, "GeneralMatrixEXUdense::Solve(...): rhs and solution must be different vectors");
+
+	Index n = rhs.NumberOfItems();
+	solution.SetNumberOfItems(n);
+	if (n == 0) { return 0; }
+#ifdef USE_EIGEN
+	Eigen::Map<Eigen::Matrix<Real, Eigen::Dynamic, 1> > x(solution.GetDataPointer(), n);
+	x = luFactorization.solve(Eigen::Map<const Eigen::Matrix<Real, Eigen::Dynamic, 1> >(rhs.GetDataPointer(), n));
+#endif
+	return 0;
 }
 
 
@@ -53,6 +86,9 @@ void GeneralMatrixEigenSparse::Reset()
 	Factorize(); //now solver should be reset to much smaller size ==> test!
 
 	SetAllZero();
+	InvalidateSymbolicFactorization();
+	analyzedOuterIndex = std::vector<EigenSparseMatrix::StorageIndex>(); //free memory
+	analyzedInnerIndex = std::vector<EigenSparseMatrix::StorageIndex>();
 	triplets.shrink_to_fit(); //this erases the data if it has zero entries
 	matrix.data().squeeze();
 }
@@ -209,6 +245,21 @@ void GeneralMatrixEigenSparse::AddSubmatrix(const GeneralMatrix& submatrix, Inde
 	}
 }
 
+//! add factor*(sparse triplet matrix) to this matrix, transforming the row indices of the triplets with LTGrows and the column indices with LTGcolumns
+void GeneralMatrixEigenSparse::AddSparseTriplets(const EXUmath::SparseTripletMatrix& submatrix, Real factor, const ArrayIndex& LTGrows, const ArrayIndex& LTGcolumns)
+{
+	CHECKandTHROW(!IsMatrixBuiltFromTriplets(), "GeneralMatrixEigenSparse::AddSparseTriplets(...): matrix must be in triplet mode !");
+
+	SetMatrixIsFactorized(false);
+	for (const EXUmath::Triplet& item : submatrix.GetTriplets())
+	{
+		if (item.value() != 0.)
+		{
+			triplets.push_back(EigenTriplet((StorageIndex)LTGrows[item.row()], (StorageIndex)LTGcolumns[item.col()], factor*item.value()));
+		}
+	}
+}
+
 //! add column vector 'vec' at 'column'; used to add a couple of entries during jacobian computation; filters zeros in sparse mode
 void GeneralMatrixEigenSparse::AddColumnVector(Index column, const Vector& vec)
 {
@@ -241,32 +292,171 @@ TimerStructureRegistrator TSReigenFactorize("eigenFactorize", TSeigenFactorize,
 Index TSeigenAnalyzePattern;
 TimerStructureRegistrator TSReigenAnalyzePattern("eigenAnalyzePattern", TSeigenAnalyzePattern, globalTimers);
 
-//! factorize matrix (invert, SparseLU, etc.); 0=success
-Index GeneralMatrixEigenSparse::Factorize()
+//! check if sparsity pattern of matrix is identical to the pattern used in last analyzePattern(...); matrix must be compressed (done in FinalizeMatrix())
+bool GeneralMatrixEigenSparse::IsPatternAnalyzed() const
 {
-	CHECKandTHROW(IsMatrixBuiltFromTriplets(), "GeneralMatrixEigenSparse::Factorize(): matrix must be built before factorization!");
+	if (!patternIsAnalyzed || !matrix.isCompressed()) { return false; }
+
+	if ((size_t)matrix.outerSize() + 1 != analyzedOuterIndex.size() || (size_t)matrix.nonZeros() != analyzedInnerIndex.size()) { return false; }
+
+	return std::equal(analyzedOuterIndex.begin(), analyzedOuterIndex.end(), matrix.outerIndexPtr()) &&
+		std::equal(analyzedInnerIndex.begin(), analyzedInnerIndex.end(), matrix.innerIndexPtr());
+}
+
+//! check symmetry of finalized matrix: |A(i,j)-A(j,i)| <= relativeTolerance*max|A|; missing entries are treated as zero
+bool GeneralMatrixEigenSparse::IsSymmetric(Real relativeTolerance) const
+{
+	if (NumberOfRows() != NumberOfColumns()) { return false; }
 
-	STARTGLOBALTIMER(TSeigenAnalyzePattern);
-	solver.analyzePattern(matrix);
-	STOPGLOBALTIMER(TSeigenAnalyzePattern);
+	const Real* values = matrix.valuePtr();
+	const StorageIndex* outerIndex = matrix.outerIndexPtr();
+	const StorageIndex* innerIndex = matrix.innerIndexPtr();
+	Real maxValue = 0.;
+	for (Index k = 0; k < (Index)matrix.nonZeros(); k++) { maxValue = EXUstd::Maximum(maxValue, fabs(values[k])); }
+	Real tolerance = relativeTolerance * maxValue;
+
+	for (Index col = 0; col < (Index)matrix.outerSize(); col++)
+	{
+		for (Index k = outerIndex[col]; k < outerIndex[col + 1]; k++)
+		{
+			Index row = innerIndex[k];
+			const StorageIndex* rowBegin = innerIndex + outerIndex[row]; //column 'row' contains the transposed entry
+			const StorageIndex* rowEnd = innerIndex + outerIndex[row + 1];
+			const StorageIndex* slot = std::lower_bound(rowBegin, rowEnd, (StorageIndex)col);
+			Real valueTransposed = (slot != rowEnd && *slot == (StorageIndex)col) ? values[slot - innerIndex] : 0.;
+			if (fabs(values[k] - valueTransposed) > tolerance) { return false; }
+		}
+	}
+	return true;
+}
+
+//! select sparse solver used in Factorize(); storage type remains EigenSparse
+void GeneralMatrixEigenSparse::SetSparseSolverType(LinearSolverType linearSolverType)
+{
+	CHECKandTHROW(IsSparseSolverTypeAvailable(linearSolverType), "GeneralMatrixEigenSparse::SetSparseSolverType: linearSolverType not available");
+
+	if (sparseSolverType != linearSolverType)
+	{
+		SetMatrixIsFactorized(false);
+		InvalidateSymbolicFactorization();
+	}
+	sparseSolverType = linearSolverType;
+
+	//symmetric mode: supernodes based on symmetric elimination tree and diagonal pivots preferred (if larger than 1% of maximum pivot of column)
+	bool symmetricMode = (linearSolverType == LinearSolverType::EigenSparseSymmetric);
+	solver.isSymmetric(symmetricMode);
+	solver.setPivotThreshold(symmetricMode ? 0.01 : 1.);
+}
+
+//! set relative residual tolerance and maximum number of iterations for EigenSparseIterative; 0 means Eigen defaults (machine precision, 2*number of columns)
+void GeneralMatrixEigenSparse::SetIterativeSolverSettings(Real tolerance, Index maxIterations)
+{
+	CHECKandTHROW(tolerance >= 0 && maxIterations >= 0, "GeneralMatrixEigenSparse::SetIterativeSolverSettings: tolerance and maxIterations must be >= 0");
+
+	solverIterative.setTolerance(tolerance != 0. ? tolerance : Eigen::NumTraits<Real>::epsilon());
+	solverIterative.setMaxIterations(maxIterations != 0 ? maxIterations : -1); //-1: Eigen uses 2*cols
+}
+
+//! check if linearSolverType is a sparse solver available in this build
+bool GeneralMatrixEigenSparse::IsSparseSolverTypeAvailable(LinearSolverType linearSolverType)
+{
+	switch (linearSolverType)
+	{
+	case LinearSolverType::EigenSparse:
+	case LinearSolverType::EigenSparseSymmetric:
+	case LinearSolverType::EigenSparseIterative:
+		return true;
+#ifdef USE_EIGEN_LGPL_SOLVERS
+	case LinearSolverType::EigenSparseLUAMD:
+	case LinearSolverType::EigenSparseLDLT:
+	case LinearSolverType::EigenSparseLLT:
+		return true;
+#endif
+	default:
+		return false;
+	}
+}
+
+//! factorize with specific Eigen solver; symbolic factorization reused if pattern is unchanged
+template<class TSolver> 
+Index GeneralMatrixEigenSparse::FactorizeTemplate(TSolver& eigenSolver)
+{
+	//symbolic factorization (ordering and elimination tree) only depends on sparsity pattern;
+	//  it is only recomputed, if the pattern has changed (e.g. due to changed contact or after SystemHasChanged())
+	if (!IsPatternAnalyzed())
+	{
+		STARTGLOBALTIMER(TSeigenAnalyzePattern);
+		symbolicFactorizationTime -= EXUstd::GetTimeInSeconds();
+		eigenSolver.analyzePattern(matrix);
+		symbolicFactorizationTime += EXUstd::GetTimeInSeconds();
+		STOPGLOBALTIMER(TSeigenAnalyzePattern);
+
+		analyzedOuterIndex.assign(matrix.outerIndexPtr(), matrix.outerIndexPtr() + matrix.outerSize() + 1);
+		analyzedInnerIndex.assign(matrix.innerIndexPtr(), matrix.innerIndexPtr() + matrix.nonZeros());
+		patternIsAnalyzed = true;
+	}
 
 	// Compute the numerical factorization 
 	STARTGLOBALTIMER(TSeigenFactorize);
-	solver.factorize(matrix);
+	eigenSolver.factorize(matrix);
 	STOPGLOBALTIMER(TSeigenFactorize);
 
-	//0: successful factorization
-	//if info = i, and i is
-	//<= A->ncol : U(i, i) is exactly zero.The factorization has been completed, but the factor U is exactly singular, and division by zero will occur if it is used to solve a system of equations.
-	//> A->ncol: number of bytes allocated when memory allocation failure occurred, plus A->ncol.If lwork = -1, it is the estimated amount of space needed, plus A->ncol.
-	Index rv = solver.info();
+	//0 (Eigen::Success): successful factorization; otherwise, e.g., Eigen::NumericalIssue for singular (SparseLU) or not positive definite (SimplicialLLT) matrices
+	Index rv = (Index)eigenSolver.info();
 	if (!rv) { SetMatrixIsFactorized(true); }
 
 	return rv;
 }
 
+//! factorize matrix (invert, SparseLU, etc.); 0=success
+Index GeneralMatrixEigenSparse::Factorize()
+{
+	CHECKandTHROW(IsMatrixBuiltFromTriplets(), "GeneralMatrixEigenSparse::Factorize(): matrix must be built before factorization!");
+
+	switch (sparseSolverType)
+	{
+	case LinearSolverType::EigenSparse:
+	case LinearSolverType::EigenSparseSymmetric:
+		return FactorizeTemplate(solver);
+#ifdef USE_EIGEN_LGPL_SOLVERS
+	case LinearSolverType::EigenSparseLUAMD:
+		return FactorizeTemplate(solverLUAMD);
+	case LinearSolverType::EigenSparseLDLT:
+	case LinearSolverType::EigenSparseLLT:
+	{
+		//SimplicialLDLT/LLT only read the lower triangular part; an unsymmetric matrix (e.g. friction, gyroscopic or follower forces) would silently give wrong Newton increments;
+		//  the relative tolerance accounts for numerical differentiation errors
+		if (!IsSymmetric(1e-6))
+		{
+			SysError("GeneralMatrixEigenSparse::Factorize(): EigenSparseLDLT and EigenSparseLLT require a symmetric system matrix; use EigenSparse or EigenSparseSymmetric for this system");
+			return (Index)Eigen::InvalidInput;
+		}
+		if (sparseSolverType == LinearSolverType::EigenSparseLDLT) { return FactorizeTemplate(solverLDLT); }
+
+		//system jacobian of static solver is negative definite ==> factorize -A; try sign of last successful factorization first
+		if (solverLLTnegative) { matrix *= -1.; }
+		Index rv = FactorizeTemplate(solverLLT);
+		if (rv)
+		{
+			matrix *= -1.;
+			solverLLTnegative = !solverLLTnegative;
+			rv = FactorizeTemplate(solverLLT);
+		}
+		if (solverLLTnegative) { matrix *= -1.; } //restore original matrix
+		return rv;
+	}
+#endif
+	case LinearSolverType::EigenSparseIterative:
+		//only the ILUT preconditioner is computed; it is reused in all Solve() calls (e.g. modified Newton) until next Factorize()
+		return FactorizeTemplate(solverIterative);
+	default:
+		CHECKandTHROWstring("GeneralMatrixEigenSparse::Factorize(): invalid sparseSolverType");
+		return 1;
+	}
+}
+
 //! multiply matrix with vector: solution = A*x
-//! this leads to memory allocation in case that the matrix is built from triplets
+//! Vector storage is mapped into Eigen (zero-copy); no memory allocation, if solution already has correct size
 void GeneralMatrixEigenSparse::MultMatrixVector(const Vector& x, Vector& solution)
 {
 	if (IsMatrixIsFactorized()) { SysError("GeneralMatrixEigenSparse::MultMatrixVector(...): matrix is already factorized ==> use Solve(...)!"); }
@@ -276,23 +466,11 @@ void GeneralMatrixEigenSparse::MultMatrixVector(const Vector& x, Vector& solutio
 
 	if (IsMatrixBuiltFromTriplets())
 	{
-		//this function could be optimized, by accessing directly the non zero entries of the sparse matrix:
-		//Eigen::Map<Eigen::VectorXd> xEigen(x.GetDataPointer(), n);
-		//Eigen::Map<Eigen::VectorXd> solutionEigen(solution.GetDataPointer(), n);
-
-		//the following way invokes memory allocation
-		Eigen::VectorXd xEigen(nColumns);
-		Eigen::VectorXd solutionEigen(nRows);
-		for (Index i = 0; i < nColumns; i++)
-		{
-			xEigen[i] = x[i];
-		}
-		solutionEigen = matrix * xEigen;
-
-		for (Index i = 0; i < nRows; i++)
-		{
-			solution[i] = solutionEigen[i];
-		}
+		CHECKandTHROW(x.NumberOfItems() == nColumns, "GeneralMatrixEigenSparse::MultMatrixVector(...): matrix number of columns must be equal to size of vector x");
+		CHECKandTHROW(&x != &solution, "GeneralMatrixEigenSparse::MultMatrixVector(...): x and solution must be different vectors");
+		Eigen::Map<const Eigen::VectorXd> xEigen(x.GetDataPointer(), nColumns);
+		Eigen::Map<Eigen::VectorXd> solutionEigen(solution.GetDataPointer(), nRows);
+		solutionEigen.noalias() = matrix * xEigen;
 	}
 	else //work on triplets; no memory allocation
 	{
@@ -306,7 +484,7 @@ void GeneralMatrixEigenSparse::MultMatrixVector(const Vector& x, Vector& solutio
 }
 
 //! multiply matrix with vector and add to solution: solution += A*x
-//! this leads to memory allocation in case that the matrix is built from triplets
+//! Vector storage is mapped into Eigen (zero-copy); no memory allocation
 void GeneralMatrixEigenSparse::MultMatrixVectorAdd(const Vector& x, Vector& solution)
 {
 	if (IsMatrixIsFactorized()) { SysError("GeneralMatrixEigenSparse::MultMatrixVector(...): matrix is already factorized ==> use Solve(...)!"); }
@@ -316,23 +494,11 @@ void GeneralMatrixEigenSparse::MultMatrixVectorAdd(const Vector& x, Vector& solu
 
 	if (IsMatrixBuiltFromTriplets())
 	{
-		//this function could be optimized, by accessing directly the non zero entries of the sparse matrix:
-		//Eigen::Map<Eigen::VectorXd> xEigen(x.GetDataPointer(), n);
-		//Eigen::Map<Eigen::VectorXd> solutionEigen(solution.GetDataPointer(), n);
-
-		//the following way invokes memory allocation
-		Eigen::VectorXd xEigen(nColumns);
-		Eigen::VectorXd solutionEigen(nRows);
-		for (Index i = 0; i < nColumns; i++)
-		{
-			xEigen[i] = x[i];
-		}
-		solutionEigen = matrix * xEigen;
-
-		for (Index i = 0; i < nRows; i++)
-		{
-			solution[i] += solutionEigen[i];
-		}
+		CHECKandTHROW(x.NumberOfItems() == nColumns, "GeneralMatrixEigenSparse::MultMatrixVectorAdd(...): matrix number of columns must be equal to size of vector x");
+		CHECKandTHROW(&x != &solution, "GeneralMatrixEigenSparse::MultMatrixVectorAdd(...): x and solution must be different vectors");
+		Eigen::Map<const Eigen::VectorXd> xEigen(x.GetDataPointer(), nColumns);
+		Eigen::Map<Eigen::VectorXd> solutionEigen(solution.GetDataPointer(), nRows);
+		solutionEigen.noalias() += matrix * xEigen;
 	}
 	else //work on triplets; no memory allocation
 	{
@@ -344,20 +510,25 @@ void GeneralMatrixEigenSparse::MultMatrixVectorAdd(const Vector& x, Vector& solu
 }
 
 //! multiply transposed(matrix) with vector: solution = A^T*x
-//! this leads to memory allocation in case that the matrix is built from triplets
+//! Vector storage is mapped into Eigen (zero-copy); no memory allocation, if solution already has correct size
 void GeneralMatrixEigenSparse::MultMatrixTransposedVector(const Vector& x, Vector& solution)
 {
 	if (IsMatrixIsFactorized()) { SysError("GeneralMatrixEigenSparse::MultMatrixTransposedVector(...): matrix is already factorized ==> use Solve(...)!"); }
 	Index nRows = NumberOfRows();
-	//Index nColumns = NumberOfColumns();
+	Index nColumns = NumberOfColumns();
 
 	if (IsMatrixBuiltFromTriplets())
 	{
-		SysError("GeneralMatrixEigenSparse::MultMatrixTransposedVector(...): currently only possible in triplet mode!");
+		CHECKandTHROW(x.NumberOfItems() == nRows, "GeneralMatrixEigenSparse::MultMatrixTransposedVector(...): matrix number of rows must be equal to size of vector x");
+		CHECKandTHROW(&x != &solution, "GeneralMatrixEigenSparse::MultMatrixTransposedVector(...): x and solution must be different vectors");
+		solution.SetNumberOfItems(nColumns);
+		Eigen::Map<const Eigen::VectorXd> xEigen(x.GetDataPointer(), nRows);
+		Eigen::Map<Eigen::VectorXd> solutionEigen(solution.GetDataPointer(), nColumns);
+		solutionEigen.noalias() = matrix.transpose() * xEigen;
 	}
 	else //work on triplets; 
 	{
-		solution.SetNumberOfItems(nRows);
+		solution.SetNumberOfItems(nColumns);
 		solution.SetAll(0.);
 
 		for (const auto& item : triplets)
@@ -367,11 +538,11 @@ void GeneralMatrixEigenSparse::MultMatrixTransposedVector(const Vector& x, Vecto
 	}
 }
 
-//! after factorization of matrix (=A), solve provides a solution vector (=x) for A*x = rhs ==> soluation = A^{-1}*rhs
-void GeneralMatrixEigenSparse::Solve(const Vector& rhs, Vector& solution)
+//! solve with specific Eigen solver; returns Eigen info (0=success)
+//! rhs and solution are mapped into Eigen (zero-copy); Eigen solvers may still use internal workspace
+template<class TSolver>
+Index GeneralMatrixEigenSparse::SolveTemplate(TSolver& eigenSolver, const Vector& rhs, Vector& solution)
 {
-	CHECKandTHROW(IsMatrixIsFactorized(), "GeneralMatrixEigenSparse::Solve( ...): matrix is not factorized!");
-
 	//will only work for Real==double!!! ==> make type check!
 	Real test=0;
 	Real* testPtr = &test;
@@ -379,24 +550,48 @@ void GeneralMatrixEigenSparse::Solve(const Vector& rhs, Vector& solution)
 
 	//n must be same as number of columns:
 	Index n = NumberOfRows()+(Index)(*testDouble);  //add (Index)(*testDouble) to suppress gcc warning
-	Eigen::VectorXd b = Eigen::Map<Eigen::VectorXd>(rhs.GetDataPointer(), n);
+	CHECKandTHROW(rhs.NumberOfItems() == n, "GeneralMatrixEigenSparse::Solve(...): size of rhs must be equal to number of rows");
+	CHECKandTHROW(&rhs != &solution, "GeneralMatrixEigenSparse::Solve(...): rhs and solution must be different vectors");
 
-	//Eigen::VectorXd b(n);
-	//for (Index i = 0; i < n; i++)
-	//{
-	//	b[i] = rhs[i];
-	//}
-
-	//static Eigen::VectorXd x;
 	solution.SetNumberOfItems(n);
-	//Eigen::VectorXd x = Eigen::Map<Eigen::VectorXd>(solution.GetDataPointer(), n);
+	Eigen::Map<const Eigen::VectorXd> b(rhs.GetDataPointer(), n);
+	Eigen::Map<Eigen::VectorXd> x(solution.GetDataPointer(), n);
 
-	Eigen::VectorXd x;
-	x = solver.solve(b);
+	x = eigenSolver.solve(b);
 
-	for (Index i = 0; i < n; i++)
+	return (Index)eigenSolver.info();
+}
+
+//! after factorization of matrix (=A), solve provides a solution vector (=x) for A*x = rhs ==> soluation = A^{-1}*rhs;
+//! 0=success; EigenSparseIterative returns Eigen::NoConvergence, if tolerance is not reached within maximum number of iterations
+Index GeneralMatrixEigenSparse::Solve(const Vector& rhs, Vector& solution)
+{
+	CHECKandTHROW(IsMatrixIsFactorized(), "GeneralMatrixEigenSparse::Solve( ...): matrix is not factorized!");
+
+	switch (sparseSolverType)
 	{
-		solution[i] = x[i];
+	case LinearSolverType::EigenSparse:
+	case LinearSolverType::EigenSparseSymmetric:
+		return SolveTemplate(solver, rhs, solution);
+#ifdef USE_EIGEN_LGPL_SOLVERS
+	case LinearSolverType::EigenSparseLUAMD:
+		return SolveTemplate(solverLUAMD, rhs, solution);
+	case LinearSolverType::EigenSparseLDLT:
+		return SolveTemplate(solverLDLT, rhs, solution);
+	case LinearSolverType::EigenSparseLLT:
+	{
+		Index rv = SolveTemplate(solverLLT, rhs, solution);
+		if (solverLLTnegative) { solution *= -1.; } //(-A)^{-1} was factorized
+		return rv;
+	}
+#endif
+	case LinearSolverType::EigenSparseIterative:
+		//BiCGSTAB with zero initial guess; if tolerance is not reached within maxIterations, the last iterate is returned together with
+		//  Eigen::NoConvergence; the Newton method then updates the Jacobian (=preconditioner) or fails
+		return SolveTemplate(solverIterative, rhs, solution);
+	default:
+		CHECKandTHROWstring("GeneralMatrixEigenSparse::Solve(): invalid sparseSolverType");
+		return 1;
 	}
 }
 
@@ -427,4 +622,296 @@ ResizableMatrix GeneralMatrixEigenSparse::GetEXUdenseMatrix() const
 	return denseMatrix;
 }
 
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//! set all values to zero; in case of valid pattern, the pattern is kept and values are refilled in next assembly
+void GeneralMatrixEigenSparseFixedPattern::SetAllZero()
+{
+	if (patternIsRecorded)
+	{
+		SetMatrixIsFactorized(false);
+		SetMatrixBuiltFromTriplets(false);
+
+		triplets.resize(0);
+		std::fill(matrix.valuePtr(), matrix.valuePtr() + matrix.nonZeros(), 0.); //keeps pattern
+		numberOfAddedEntries = 0;
+		refillMode = true;
+		recordPattern = false;
+	}
+	else
+	{
+		GeneralMatrixEigenSparse::SetAllZero();
+		columnTriplets.resize(0);
+		refillMode = false;
+		recordPattern = true; //next assembly is recorded
+	}
+}
+
+//! reset matrices and free memory
+void GeneralMatrixEigenSparseFixedPattern::Reset()
+{
+	GeneralMatrixEigenSparse::Reset();
+	patternIsRecorded = false;
+	recordPattern = false;
+	refillMode = false;
+	scatterIndex.Flush();
+	columnTriplets = EigenTripletVector(); //free memory
+}
+
+//! in refill mode: copy values added so far into triplets and continue in triplet mode
+void GeneralMatrixEigenSparseFixedPattern::SwitchToTripletMode()
+{
+	if (refillMode)
+	{
+		triplets.resize(0);
+		for (Index col = 0; col < (Index)matrix.outerSize(); col++)
+		{
+			for (EigenSparseMatrix::InnerIterator it(matrix, col); it; ++it)
+			{
+				if (it.value() != 0.) { triplets.push_back(EigenTriplet(it.row(), it.col(), it.value())); }
+			}
+		}
+		refillMode = false;
+		patternIsRecorded = false;
+	}
+	triplets.insert(triplets.end(), columnTriplets.begin(), columnTriplets.end()); //stop recording
+	columnTriplets.resize(0);
+	recordPattern = false; //pattern will be recorded in next assembly
+}
+
+//! multiply either triplets or matrix entries with factor
+void GeneralMatrixEigenSparseFixedPattern::MultiplyWithFactor(Real factor)
+{
+	if (refillMode)
+	{
+		SetMatrixIsFactorized(false);
+		matrix *= factor;
+	}
+	else
+	{
+		GeneralMatrixEigenSparse::MultiplyWithFactor(factor);
+	}
+}
+
+//! set the matrix with a dense matrix; switches to triplet mode
+void GeneralMatrixEigenSparseFixedPattern::SetMatrix(const Matrix& otherMatrix)
+{
+	refillMode = false;
+	recordPattern = false;
+	patternIsRecorded = false;
+	columnTriplets.resize(0);
+	GeneralMatrixEigenSparse::SetMatrix(otherMatrix);
+}
+
+//! add (possibly) smaller factor*Matrix to this matrix, transforming the row indices of the submatrix with LTGrows and the column indices with LTGcolumns;
+//! zeros are not filtered, as they are part of the fixed pattern
+void GeneralMatrixEigenSparseFixedPattern::AddSubmatrix(const Matrix& submatrix, Real factor, const ArrayIndex& LTGrows, const ArrayIndex& LTGcolumns, Index rowOffset, Index columnOffset)
+{
+	CHECKandTHROW(!IsMatrixBuiltFromTriplets(), "GeneralMatrixEigenSparseFixedPattern::AddSubmatrix(const Matrix&, const ArrayIndex& LTGrows, const ArrayIndex& LTGcolumns, ...): matrix must not be finalized!");
+
+	for (Index i = 0; i < submatrix.NumberOfRows(); i++)
+	{
+		for (Index j = 0; j < submatrix.NumberOfColumns(); j++)
+		{
+			AddEntry(LTGrows[i] + rowOffset, LTGcolumns[j] + columnOffset, factor*submatrix(i, j));
+		}
+	}
+}
+
+//! add (possibly) smaller factor*Transposed(Matrix) to this matrix, transforming the row indices of the submatrix with LTGrows and the column indices with LTGcolumns
+void GeneralMatrixEigenSparseFixedPattern::AddSubmatrixTransposed(const Matrix& submatrix, Real factor, const ArrayIndex& LTGrows, const ArrayIndex& LTGcolumns, Index rowOffset, Index columnOffset)
+{
+	CHECKandTHROW(!IsMatrixBuiltFromTriplets(), "GeneralMatrixEigenSparseFixedPattern::AddSubmatrixTransposed(const Matrix&, const ArrayIndex& LTGrows, const ArrayIndex& LTGcolumns, ...): matrix must not be finalized!");
+
+	for (Index j = 0; j < submatrix.NumberOfRows(); j++)
+	{
+		for (Index i = 0; i < submatrix.NumberOfColumns(); i++)
+		{
+			AddEntry(LTGrows[i] + rowOffset, LTGcolumns[j] + columnOffset, factor*submatrix(j, i));
+		}
+	}
+}
+
+//! add triplets of GeneralMatrixEigenSparse submatrix (in triplet mode) to this matrix
+void GeneralMatrixEigenSparseFixedPattern::AddSubmatrix(const GeneralMatrix& submatrix, Index rowOffset, Index columnOffset)
+{
+	CHECKandTHROW((GetSystemMatrixType() == submatrix.GetSystemMatrixType()), "GeneralMatrixEigenSparseFixedPattern::AddSubmatrix: invalid SystemMatrixType!");
+	CHECKandTHROW(!IsMatrixBuiltFromTriplets(), "GeneralMatrixEigenSparseFixedPattern::AddSubmatrix(const GeneralMatrix&, ...): matrix must not be finalized!");
+
+	const GeneralMatrixEigenSparse& m = (const GeneralMatrixEigenSparse&)submatrix;
+	CHECKandTHROW(!m.IsMatrixBuiltFromTriplets(), "GeneralMatrixEigenSparseFixedPattern::AddSubmatrix(const GeneralMatrix&, ...): submatrix must be in triplet mode !");
+
+	SetMatrixIsFactorized(false);
+	for (const EigenTriplet& item : m.GetEigenTriplets())
+	{
+		AddEntry((Index)item.row() + rowOffset, (Index)item.col() + columnOffset, item.value());
+	}
+}
+
+//! add factor*(sparse triplet matrix) to this matrix; entries are added in triplet order, giving a reproducible pattern
+void GeneralMatrixEigenSparseFixedPattern::AddSparseTriplets(const EXUmath::SparseTripletMatrix& submatrix, Real factor, const ArrayIndex& LTGrows, const ArrayIndex& LTGcolumns)
+{
+	CHECKandTHROW(!IsMatrixBuiltFromTriplets(), "GeneralMatrixEigenSparseFixedPattern::AddSparseTriplets(...): matrix must not be finalized!");
+
+	SetMatrixIsFactorized(false);
+	for (const EXUmath::Triplet& item : submatrix.GetTriplets())
+	{
+		AddEntry(LTGrows[item.row()], LTGcolumns[item.col()], factor*item.value());
+	}
+}
+
+//! add column vector 'vec' at 'column'; zeros are filtered; in refill mode, entries are added in place by searching the row in the column pattern,
+//! independently of the AddEntry sequence; a nonzero entry outside the recorded pattern switches to triplet mode
+void GeneralMatrixEigenSparseFixedPattern::AddColumnVector(Index column, const Vector& vec)
+{
+	CHECKandTHROW(!IsMatrixBuiltFromTriplets(), "GeneralMatrixEigenSparseFixedPattern::AddColumnVector(...): matrix must not be finalized!");
+
+	Index i = 0; //row
+	if (refillMode)
+	{
+		SetMatrixIsFactorized(false);
+		const StorageIndex* innerIndex = matrix.innerIndexPtr();
+		const StorageIndex* columnBegin = innerIndex + matrix.outerIndexPtr()[column];
+		const StorageIndex* columnEnd = innerIndex + matrix.outerIndexPtr()[column + 1];
+		for (; i < vec.NumberOfItems(); i++)
+		{
+			if (vec[i] != 0.)
+			{
+				const StorageIndex* slot = std::lower_bound(columnBegin, columnEnd, (StorageIndex)i);
+				if (slot == columnEnd || *slot != (StorageIndex)i)
+				{
+					SwitchToTripletMode(); //pattern has changed; remaining entries are added as triplets
+					break;
+				}
+				matrix.valuePtr()[slot - innerIndex] += vec[i];
+			}
+		}
+		if (i == vec.NumberOfItems()) { return; }
+	}
+
+	//triplet mode; while recording, column entries are kept separately to keep the AddEntry sequence consistent
+	EigenTripletVector& target = recordPattern ? columnTriplets : triplets;
+	for (; i < vec.NumberOfItems(); i++)
+	{
+		if (vec[i] != 0.)
+		{
+			target.push_back(EigenTriplet((StorageIndex)i, (StorageIndex)column, vec[i]));
+		}
+	}
+}
+
+//! After filling the matrix, it is finalized for further operations (matrix*vector, factorization, ...); computes scatterIndex for recorded pattern
+void GeneralMatrixEigenSparseFixedPattern::FinalizeMatrix()
+{
+	if (refillMode) //values already in matrix; not added entries of pattern are zero
+	{
+		SetMatrixIsFactorized(false);
+		refillMode = false;
+		SetMatrixBuiltFromTriplets();
+		return;
+	}
+
+	Index numberOfSequencedEntries = (Index)triplets.size(); //entries added by AddEntry(...)
+	triplets.insert(triplets.end(), columnTriplets.begin(), columnTriplets.end());
+	columnTriplets.resize(0);
+
+	GeneralMatrixEigenSparse::FinalizeMatrix(); //setFromTriplets keeps zeros and sorts inner indices
+
+	if (recordPattern)
+	{
+		const StorageIndex* outerIndex = matrix.outerIndexPtr();
+		const StorageIndex* innerIndex = matrix.innerIndexPtr();
+
+		scatterIndex.SetNumberOfItems(numberOfSequencedEntries);
+		for (Index k = 0; k < numberOfSequencedEntries; k++)
+		{
+			const EigenTriplet& item = triplets[k];
+			const StorageIndex* slot = std::lower_bound(innerIndex + outerIndex[item.col()], innerIndex + outerIndex[item.col() + 1], item.row());
+			scatterIndex[k] = (Index)(slot - innerIndex);
+		}
+		patternIsRecorded = true;
+		recordPattern = false;
+	}
+}
+
+//! multiply matrix with vector: solution = A*x
+void GeneralMatrixEigenSparseFixedPattern::MultMatrixVector(const Vector& x, Vector& solution)
+{
+	if (refillMode)
+	{
+		solution.SetNumberOfItems(NumberOfRows());
+		solution.SetAll(0.);
+		MultMatrixVectorAdd(x, solution);
+	}
+	else
+	{
+		GeneralMatrixEigenSparse::MultMatrixVector(x, solution);
+	}
+}
+
+//! multiply matrix with vector and add to solution: solution += A*x
+void GeneralMatrixEigenSparseFixedPattern::MultMatrixVectorAdd(const Vector& x, Vector& solution)
+{
+	if (refillMode) //work on values of matrix; no memory allocation
+	{
+		CHECKandTHROW(solution.NumberOfItems() == NumberOfRows(), "GeneralMatrixEigenSparseFixedPattern::MultMatrixVectorAdd(...): matrix number of rows must be equal to size of solution vector");
+		for (Index col = 0; col < (Index)matrix.outerSize(); col++)
+		{
+			for (EigenSparseMatrix::InnerIterator it(matrix, col); it; ++it)
+			{
+				solution[it.row()] += x[col] * it.value();
+			}
+		}
+	}
+	else
+	{
+		GeneralMatrixEigenSparse::MultMatrixVectorAdd(x, solution);
+	}
+}
+
+//! multiply transposed(matrix) with vector: solution = A^T*x
+void GeneralMatrixEigenSparseFixedPattern::MultMatrixTransposedVector(const Vector& x, Vector& solution)
+{
+	if (refillMode)
+	{
+		solution.SetNumberOfItems(NumberOfColumns());
+		solution.SetAll(0.);
+		for (Index col = 0; col < (Index)matrix.outerSize(); col++)
+		{
+			for (EigenSparseMatrix::InnerIterator it(matrix, col); it; ++it)
+			{
+				solution[col] += x[it.row()] * it.value();
+			}
+		}
+	}
+	else
+	{
+		GeneralMatrixEigenSparse::MultMatrixTransposedVector(x, solution);
+	}
+}
+
+//! return a dense matrix from any other matrix: requires a copy - SLOW!
+ResizableMatrix GeneralMatrixEigenSparseFixedPattern::GetEXUdenseMatrix() const
+{
+	if (refillMode)
+	{
+		ResizableMatrix denseMatrix(NumberOfRows(), NumberOfColumns());
+		denseMatrix.SetAll(0.);
+		for (Index col = 0; col < (Index)matrix.outerSize(); col++)
+		{
+			for (EigenSparseMatrix::InnerIterator it(matrix, col); it; ++it)
+			{
+				denseMatrix(it.row(), col) = it.value();
+			}
+		}
+		return denseMatrix;
+	}
+	ResizableMatrix denseMatrix = GeneralMatrixEigenSparse::GetEXUdenseMatrix();
+	if (!IsMatrixBuiltFromTriplets())
+	{
+		for (const EigenTriplet& item : columnTriplets) { denseMatrix(item.row(), item.col()) += item.value(); }
+	}
+	return denseMatrix;
+}
+
 #endif //eigen sparse solver
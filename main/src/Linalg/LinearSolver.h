@@ -14,11 +14,16 @@
 //BasicLinalg provides consistent includes for BasicDefinitions, arrays, vectors and matrices
 #include "Linalg/BasicLinalg.h"	
 #include "Main/OutputVariable.h"
+#include "Linalg/MatrixContainer.h" //for SparseTripletMatrix
 #include <vector> //for eigen triplets
 #include <iostream>
 
 #define USE_EIGEN
+//USE_EIGEN_LGPL_SOLVERS: define globally (compiler flag) to enable LinearSolverType::EigenSparseLUAMD/EigenSparseLDLT/EigenSparseLLT; 
+//  these solvers use LGPL licensed parts of Eigen (AMD ordering, SimplicialCholesky), which are otherwise excluded by EIGEN_MPL2_ONLY
+#ifndef USE_EIGEN_LGPL_SOLVERS
 #define EIGEN_MPL2_ONLY //add this line at the place of 'USE_EIGEN'; it guaranties to raise a compilation error, if non-MPL2 licensed parts of Eigen are used (see also LICENSE.txt file and COPYING.README of Eigen)
+#endif
 
 #ifdef USE_EIGEN
 	#define USE_EIGEN_SPARSE_SOLVER
@@ -26,12 +31,18 @@
 	#include "../Eigen/Dense"
 	//#include "Eigen/SuperLUSupport"
 	#include "../Eigen/SparseLU"
+	#include "../Eigen/IterativeLinearSolvers" //BiCGSTAB + IncompleteLUT; MPL2 (ILUT uses COLAMD ordering with EIGEN_MPL2_ONLY)
+	#ifdef USE_EIGEN_LGPL_SOLVERS
+	#include "../Eigen/SparseCholesky"
+	#endif
 	//#include <Eigen/Core>
 	#include <omp.h> //for eigen omp support
 	typedef Eigen::Triplet<Real> EigenTriplet;				//! this is a simple (row,col,value) structure for sparse matrix non zero entries
 	typedef std::vector<EigenTriplet> EigenTripletVector;	//! this vector stores (dynamically!) the triplets
 	typedef Eigen::SparseMatrix<Real> EigenSparseMatrix;	//! declares a column-major sparse matrix type of double
 	typedef Eigen::SparseMatrix<Real>::StorageIndex StorageIndex;	//! conversion to Index necessary
+	typedef Eigen::Matrix<Real, Eigen::Dynamic, Eigen::Dynamic> EigenDenseMatrix;	//! column-major dense matrix, used for LU factorization
+	typedef Eigen::Matrix<Real, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> EigenDenseMatrixRowMajor;	//! row-major dense matrix, compatible with storage of exudyn Matrix
 #endif
 
 
@@ -89,6 +100,9 @@ public:
 	//! add possibly smaller GeneralMatrix (with same type as *this !) to *this matrix; in case of sparse matrices, only the triplets of GeneralMatrixEigenSparse are added
 	virtual void AddSubmatrix(const GeneralMatrix& submatrix, Index rowOffset = 0, Index columnOffset = 0) = 0;
 
+	//! add factor*(sparse triplet matrix) to this matrix, transforming the row indices of the triplets with LTGrows and the column indices with LTGcolumns
+	virtual void AddSparseTriplets(const EXUmath::SparseTripletMatrix& submatrix, Real factor, const ArrayIndex& LTGrows, const ArrayIndex& LTGcolumns) = 0;
+
 	//! add column vector 'vec' at 'column'; used to add a couple of entries during jacobian computation; filters zeros in sparse mode
 	virtual void AddColumnVector(Index column, const Vector& vec) = 0;
 
@@ -98,8 +112,12 @@ public:
 
 	//! factorize matrix (invert, SparseLU, etc.)
 	virtual Index Factorize() = 0; 
-	//! after factorization of matrix (=A), solve provides a solution vector (=x) for A*x = rhs ==> soluation = A^{-1}*rhs
-	virtual void Solve(const Vector& rhs, Vector& solution) = 0;
+	//! accumulated CPU time for symbolic factorizations (ordering, elimination tree) in Factorize(); 0 for matrices without separate symbolic factorization
+	virtual Real GetSymbolicFactorizationTime() const { return 0.; }
+	//! after factorization of matrix (=A), solve provides a solution vector (=x) for A*x = rhs ==> soluation = A^{-1}*rhs; 0=success, otherwise e.g. iterative solver did not converge
+	virtual Index Solve(const Vector& rhs, Vector& solution) = 0;
+	//! number of iterations of last Solve() for iterative solvers; 0 for direct solvers
+	virtual Index GetNumberOfSolverIterations() const { return 0; }
 
 	//! multiply matrix with vector: solution = A*x
 	virtual void MultMatrixVector(const Vector& x, Vector& solution) = 0;
@@ -127,10 +145,15 @@ public:
 
 
 //! specialization of GeneralMatrix to exudyn dense matrix
+//! Factorize() computes an LU factorization with partial pivoting (Eigen::PartialPivLU, blocked algorithm) and keeps matrix unchanged;
+//! the factorization is stored per GeneralMatrixEXUdense object (thread-safe) and reused by Solve(...) until matrix is modified
 class GeneralMatrixEXUdense : public GeneralMatrix
 {
 private:
 	ResizableMatrix matrix; //!< internal dense matrix storage:
+#ifdef USE_EIGEN
+	Eigen::PartialPivLU<EigenDenseMatrix> luFactorization; //!< LU factorization of matrix, computed in Factorize(); memory is reused as long as size does not change
+#endif
 
 public:
 	GeneralMatrixEXUdense() { SetMatrixIsFactorized(false); }
@@ -203,6 +226,16 @@ public:
 		matrix.AddSubmatrix(m.GetMatrixEXUdense(), rowOffset, columnOffset);
 	}
 
+	//! add factor*(sparse triplet matrix) to this matrix, transforming the row indices of the triplets with LTGrows and the column indices with LTGcolumns
+	virtual void AddSparseTriplets(const EXUmath::SparseTripletMatrix& submatrix, Real factor, const ArrayIndex& LTGrows, const ArrayIndex& LTGcolumns)
+	{
+		SetMatrixIsFactorized(false);
+		for (const EXUmath::Triplet& item : submatrix.GetTriplets())
+		{
+			matrix(LTGrows[item.row()], LTGcolumns[item.col()]) += factor * item.value();
+		}
+	}
+
 	//! add column vector 'vec' at 'column'; used to add a couple of entries during jacobian computation; filters zeros in sparse mode
 	virtual void AddColumnVector(Index column, const Vector& vec)
 	{
@@ -242,12 +275,8 @@ public:
 		EXUmath::MultMatrixTransposedVector(matrix, x, solution);
 	}
 
-	//!after factorization of matrix (=A), solve provides a solution vector (=x) for A*x = rhs ==> soluation = A^{-1}*rhs
-	virtual void Solve(const Vector& rhs, Vector& solution)
-	{
-		if (!IsMatrixIsFactorized()) { SysError("GeneralMatrixEXUdense::Solve(...): matrix is not factorized!"); }
-		EXUmath::MultMatrixVector(matrix, rhs, solution);
-	}
+	//!after factorization of matrix (=A), solve provides a solution vector (=x) for A*x = rhs ==> soluation = A^{-1}*rhs; 0=success
+	virtual Index Solve(const Vector& rhs, Vector& solution);
 
 	//! return a dense matrix from any other matrix: requires a copy - SLOW!
 	virtual ResizableMatrix GetEXUdenseMatrix() const
@@ -270,7 +299,7 @@ public:
 #ifdef USE_EIGEN_SPARSE_SOLVER
 class GeneralMatrixEigenSparse : public GeneralMatrix
 {
-private:
+protected:
 	bool matrixBuiltFromTriplets;	//!< flag is set true as soon as the matrix is built from triplets; false, as soon as the triplets are modified
 	Index numberOfRows;				//!< as the triplet structure does not provide this information, it must be stored separately
 	Index numberOfColumns;			//!< as the triplet structure does not provide this information, it must be stored separately
@@ -279,7 +308,21 @@ private:
 #ifdef USE_EIGEN_SPARSE_SOLVER
 	EigenSparseMatrix matrix;	 //this is the sparse matrix built from triplets
 	EigenTripletVector triplets; //this contains a redundant set of matrix entries
+	LinearSolverType sparseSolverType; //!< selects the solver used for factorization: EigenSparse or EigenSparseSymmetric (solver), EigenSparseLUAMD, EigenSparseLDLT, EigenSparseLLT
 	Eigen::SparseLU<Eigen::SparseMatrix<Real>, Eigen::COLAMDOrdering<int> >   solver; //this is the solver for the matrix
+#ifdef USE_EIGEN_LGPL_SOLVERS
+	Eigen::SparseLU<Eigen::SparseMatrix<Real>, Eigen::AMDOrdering<int> >   solverLUAMD;	//!< LU solver with approximate minimum degree ordering
+	Eigen::SimplicialLDLT<Eigen::SparseMatrix<Real> >   solverLDLT;						//!< solver for symmetric matrices; only lower triangular part is used
+	Eigen::SimplicialLLT<Eigen::SparseMatrix<Real> >   solverLLT;							//!< solver for symmetric positive definite matrices; only lower triangular part is used
+	bool solverLLTnegative;	//!< true, if solverLLT factorized -A, as A is negative definite (e.g. static jacobian)
+#endif
+	Eigen::BiCGSTAB<EigenSparseMatrix, Eigen::IncompleteLUT<Real> > solverIterative; //!< iterative solver; Factorize() only computes the ILUT preconditioner, which is kept for all Solve() until next Factorize()
+
+	//data for reuse of symbolic factorization (COLAMD ordering + analyzePattern):
+	bool patternIsAnalyzed;							//!< true, if solver.analyzePattern(...) has been done for the sparsity pattern stored in analyzedOuterIndex/analyzedInnerIndex
+	std::vector<EigenSparseMatrix::StorageIndex> analyzedOuterIndex; //!< outer (column) index array of matrix for which pattern has been analyzed
+	std::vector<EigenSparseMatrix::StorageIndex> analyzedInnerIndex; //!< inner (row) index array of matrix for which pattern has been analyzed
+	Real symbolicFactorizationTime;					//!< accumulated CPU time of analyzePattern(...) calls
 #endif
 
 public:
@@ -289,6 +332,13 @@ public:
 		SetMatrixBuiltFromTriplets(false);
 		numberOfRows = 0;
 		numberOfColumns = 0;
+		patternIsAnalyzed = false;
+		symbolicFactorizationTime = 0.;
+		sparseSolverType = LinearSolverType::EigenSparse;
+		SetIterativeSolverSettings(0., 0);
+#ifdef USE_EIGEN_LGPL_SOLVERS
+		solverLLTnegative = false;
+#endif
 	}
 
 	//! information on storage type
@@ -299,11 +349,11 @@ public:
 	virtual bool IsMatrixBuiltFromTriplets() const { return matrixBuiltFromTriplets; }
 
 	//! get (read) matrix as dense exudyn Matrix
-	const EigenTripletVector& GetEigenTriplets() const { return triplets; }
+	virtual const EigenTripletVector& GetEigenTriplets() const { return triplets; }
 
 	//! get (write) matrix as dense exudyn Matrix; also in this case, solvability may be lost; sparse matrix is invalid
 	//! however, we never know what else is done with the matrix afterwards ...
-	EigenTripletVector& GetEigenTriplets() { 
+	virtual EigenTripletVector& GetEigenTriplets() { 
 		SetMatrixIsFactorized(false); 
 		SetMatrixBuiltFromTriplets(false);  
 		return triplets; 
@@ -314,6 +364,7 @@ public:
 	{
 		SetMatrixIsFactorized(false);
 		SetMatrixBuiltFromTriplets(false);
+		InvalidateSymbolicFactorization(); //called at solver initialization; pattern must be analyzed again
 
 		numberOfRows = numberOfRowsInit;
 		numberOfColumns = numberOfColumnsInit;
@@ -330,6 +381,46 @@ public:
 	//! reset matrices and free memory
 	virtual void Reset();
 
+	//! force new symbolic factorization (ordering + analyzePattern) in next Factorize(), e.g., after system has changed
+	void InvalidateSymbolicFactorization() { patternIsAnalyzed = false; }
+
+	//! select sparse solver used in Factorize(); storage type remains EigenSparse
+	void SetSparseSolverType(LinearSolverType linearSolverType);
+
+	//! sparse solver used in Factorize()
+	LinearSolverType GetSparseSolverType() const { return sparseSolverType; }
+
+	//! set relative residual tolerance and maximum number of iterations for EigenSparseIterative; 0 means Eigen defaults (machine precision, 2*number of columns)
+	void SetIterativeSolverSettings(Real tolerance, Index maxIterations);
+
+	//! number of iterations and estimated relative residual of last Solve() with EigenSparseIterative
+	Index GetIterativeSolverIterations() const { return (Index)solverIterative.iterations(); }
+	Real GetIterativeSolverError() const { return solverIterative.error(); }
+
+	//! number of iterations of last Solve() for EigenSparseIterative; 0 for direct solvers
+	virtual Index GetNumberOfSolverIterations() const { return (sparseSolverType == LinearSolverType::EigenSparseIterative) ? GetIterativeSolverIterations() : 0; }
+
+	//! check if linearSolverType is a sparse solver available in this build
+	static bool IsSparseSolverTypeAvailable(LinearSolverType linearSolverType);
+
+	//! check if sparsity pattern of matrix is identical to the pattern used in last analyzePattern(...)
+	bool IsPatternAnalyzed() const;
+
+	//! accumulated CPU time for symbolic factorizations (analyzePattern) in Factorize()
+	virtual Real GetSymbolicFactorizationTime() const { return symbolicFactorizationTime; }
+
+	//! check symmetry of finalized matrix: |A(i,j)-A(j,i)| <= relativeTolerance*max|A|; missing entries are treated as zero
+	bool IsSymmetric(Real relativeTolerance) const;
+
+private:
+	//! factorize with specific Eigen solver; symbolic factorization reused if pattern is unchanged
+	template<class TSolver> Index FactorizeTemplate(TSolver& eigenSolver);
+
+	//! solve with specific Eigen solver
+	template<class TSolver> Index SolveTemplate(TSolver& eigenSolver, const Vector& rhs, Vector& solution);
+
+public:
+
 	//! multiply either triplets or matrix entries with factor
 	virtual void MultiplyWithFactor(Real factor);
 	
@@ -351,6 +442,10 @@ public:
 	//! operations must be both in triplet mode!
 	virtual void AddSubmatrix(const GeneralMatrix& submatrix, Index rowOffset = 0, Index columnOffset = 0);
 
+	//! add factor*(sparse triplet matrix) to this matrix, transforming the row indices of the triplets with LTGrows and the column indices with LTGcolumns;
+	//! only non-zero values are considered for the triplets (row,col,value)
+	virtual void AddSparseTriplets(const EXUmath::SparseTripletMatrix& submatrix, Real factor, const ArrayIndex& LTGrows, const ArrayIndex& LTGcolumns);
+
 	//! add column vector 'vec' at 'column'; used to add a couple of entries during jacobian computation; filters zeros in sparse mode
 	virtual void AddColumnVector(Index column, const Vector& vec);
 
@@ -372,8 +467,9 @@ public:
 	//! this leads to memory allocation in case that the matrix is built from triplets
 	virtual void MultMatrixTransposedVector(const Vector& x, Vector& solution);
 
-	//! after factorization of matrix (=A), solve provides a solution vector (=x) for A*x = rhs ==> soluation = A^{-1}*rhs
-	virtual void Solve(const Vector& rhs, Vector& solution);
+	//! after factorization of matrix (=A), solve provides a solution vector (=x) for A*x = rhs ==> soluation = A^{-1}*rhs;
+	//! 0=success; EigenSparseIterative returns Eigen::NoConvergence, if tolerance is not reached within maximum number of iterations
+	virtual Index Solve(const Vector& rhs, Vector& solution);
 
 	//! return a dense matrix from any other matrix: requires a copy - SLOW!
 	virtual ResizableMatrix GetEXUdenseMatrix() const;
@@ -385,6 +481,133 @@ public:
 	}
 };
 
+//! specialization of GeneralMatrixEigenSparse for the system matrix, which is repeatedly assembled with the same sparsity pattern (e.g. Newton jacobian):
+//! 1) in the first assembly after SetNumberOfRowsAndColumns(...), all entries (including zeros) are recorded as triplets;
+//!    FinalizeMatrix() builds the compressed column storage (CSC) and a scatter map from the k-th added entry (object, local row, local column) to its value slot
+//! 2) in further assemblies, SetAllZero() only sets the values to zero and added entries are summed up in place in the values of the CSC matrix,
+//!    without triplets, sorting or memory allocation; the sparsity pattern stays the same, such that the symbolic factorization is reused
+//! 3) if the sequence of added entries differs from the recorded one (e.g. changed contact, inactive connector), the matrix falls back to triplet mode
+//!    and the pattern is recorded again in the next assembly
+class GeneralMatrixEigenSparseFixedPattern : public GeneralMatrixEigenSparse
+{
+private:
+	ArrayIndex scatterIndex;		//!< value slot in matrix.valuePtr() for the k-th added entry of the recorded assembly
+	bool patternIsRecorded;			//!< true, if matrix contains a valid pattern and scatterIndex is valid
+	bool recordPattern;				//!< true, if the current assembly is recorded (triplets with zeros) to compute a new scatterIndex
+	bool refillMode;				//!< true, if the current assembly adds values in place into matrix (matrix values are valid, triplets are not used)
+	Index numberOfAddedEntries;		//!< counter for added entries in refill mode
+	EigenTripletVector columnTriplets; //!< entries added by AddColumnVector(...) while recording; they are not part of the AddEntry sequence and are merged in FinalizeMatrix()
+
+public:
+	GeneralMatrixEigenSparseFixedPattern()
+	{
+		patternIsRecorded = false;
+		recordPattern = false;
+		refillMode = false;
+		numberOfAddedEntries = 0;
+	}
+
+	//! check if currently values are added in place
+	bool IsRefillMode() const { return refillMode; }
+
+	//! triplets are not available in refill mode
+	virtual const EigenTripletVector& GetEigenTriplets() const
+	{
+		CHECKandTHROW(!refillMode, "GeneralMatrixEigenSparseFixedPattern::GetEigenTriplets() const: triplets not available during in-place assembly");
+		return triplets;
+	}
+
+	//! write access to triplets switches to triplet mode
+	virtual EigenTripletVector& GetEigenTriplets()
+	{
+		SwitchToTripletMode();
+		recordPattern = false;
+		return GeneralMatrixEigenSparse::GetEigenTriplets();
+	}
+
+	//! new size invalidates the recorded pattern
+	virtual void SetNumberOfRowsAndColumns(Index numberOfRowsInit, Index numberOfColumnsInit)
+	{
+		GeneralMatrixEigenSparse::SetNumberOfRowsAndColumns(numberOfRowsInit, numberOfColumnsInit);
+		columnTriplets.resize(0);
+		patternIsRecorded = false;
+		recordPattern = false;
+		refillMode = false;
+	}
+
+	//! set all values to zero; in case of valid pattern, the pattern is kept and values are refilled in next assembly
+	virtual void SetAllZero();
+
+	//! reset matrices and free memory
+	virtual void Reset();
+
+	//! multiply either triplets or matrix entries with factor
+	virtual void MultiplyWithFactor(Real factor);
+
+	//! set the matrix with a dense matrix; switches to triplet mode
+	virtual void SetMatrix(const Matrix& otherMatrix);
+
+	//! add (possibly) smaller factor*Matrix to this matrix, transforming the row indices of the submatrix with LTGrows and the column indices with LTGcolumns;
+	//! zeros are not filtered, as they are part of the fixed pattern
+	virtual void AddSubmatrix(const Matrix& submatrix, Real factor, const ArrayIndex& LTGrows, const ArrayIndex& LTGcolumns, Index rowOffset = 0, Index columnOffset = 0);
+
+	//! add (possibly) smaller factor*Transposed(Matrix) to this matrix, transforming the row indices of the submatrix with LTGrows and the column indices with LTGcolumns
+	virtual void AddSubmatrixTransposed(const Matrix& submatrix, Real factor, const ArrayIndex& LTGrows, const ArrayIndex& LTGcolumns, Index rowOffset = 0, Index columnOffset = 0);
+
+	//! add triplets of GeneralMatrixEigenSparse submatrix (in triplet mode) to this matrix
+	virtual void AddSubmatrix(const GeneralMatrix& submatrix, Index rowOffset = 0, Index columnOffset = 0);
+
+	//! add factor*(sparse triplet matrix) to this matrix, transforming the row indices of the triplets with LTGrows and the column indices with LTGcolumns; zeros are not filtered
+	virtual void AddSparseTriplets(const EXUmath::SparseTripletMatrix& submatrix, Real factor, const ArrayIndex& LTGrows, const ArrayIndex& LTGcolumns);
+
+	//! add column vector 'vec' at 'column'; zeros are filtered; in refill mode, entries are added in place by searching the row in the column pattern,
+	//! independently of the AddEntry sequence; a nonzero entry outside the recorded pattern switches to triplet mode
+	virtual void AddColumnVector(Index column, const Vector& vec);
+
+	//! After filling the matrix, it is finalized for further operations (matrix*vector, factorization, ...); computes scatterIndex for recorded pattern
+	virtual void FinalizeMatrix();
+
+	//! multiply matrix with vector: solution = A*x
+	virtual void MultMatrixVector(const Vector& x, Vector& solution);
+
+	//! multiply matrix with vector and add to solution: solution += A*x
+	virtual void MultMatrixVectorAdd(const Vector& x, Vector& solution);
+
+	//! multiply transposed(matrix) with vector: solution = A^T*x
+	virtual void MultMatrixTransposedVector(const Vector& x, Vector& solution);
+
+	//! return a dense matrix from any other matrix: requires a copy - SLOW!
+	virtual ResizableMatrix GetEXUdenseMatrix() const;
+
+private:
+	//! add single entry either in place (refill mode) or as triplet
+	void AddEntry(Index row, Index column, Real value)
+	{
+		if (refillMode)
+		{
+			if (numberOfAddedEntries < scatterIndex.NumberOfItems())
+			{
+				Index slot = scatterIndex[numberOfAddedEntries];
+				//check that entry is identical to recorded pattern:
+				if (matrix.innerIndexPtr()[slot] == (StorageIndex)row && slot >= (Index)matrix.outerIndexPtr()[column] && slot < (Index)matrix.outerIndexPtr()[column + 1])
+				{
+					matrix.valuePtr()[slot] += value;
+					numberOfAddedEntries++;
+					return;
+				}
+			}
+			SwitchToTripletMode(); //pattern has changed
+		}
+		if (recordPattern || value != 0.)
+		{
+			triplets.push_back(EigenTriplet((StorageIndex)row, (StorageIndex)column, value));
+		}
+	}
+
+	//! in refill mode: copy values added so far into triplets and continue in triplet mode
+	void SwitchToTripletMode();
+};
+
 //std::ostream& operator<<(std::ostream& os, const GeneralMatrix& matrix)
 //{
 //	if (matrix.GetSystemMatrixType() == LinearSolverType::EXUdense)
@@ -411,6 +634,10 @@ public:
 
 };
 
+class GeneralMatrixEigenSparseFixedPattern : public GeneralMatrixEigenSparse
+{
+};
+
 #endif
 
 #endif //include once
\ No newline at end of file
@@ -62,6 +62,14 @@ public:
 		this->numberOfItems = vector.NumberOfItems();
     }
 
+	//! copy constructor links to the same data; no copying, no memory allocation
+	//! (the implicit copy constructor would allocate a copy in VectorBase<T>, which is never deallocated by ~LinkedDataVectorBase)
+	LinkedDataVectorBase(const LinkedDataVectorBase& other) : VectorBase<T>()
+	{
+		this->data = other.data;
+		this->numberOfItems = other.numberOfItems;
+	}
+
 	//! Initialize LinkedDataVectorBase by data given by vector at startPosition, using numberOfItemsLinked items (LinkedDataVectorBase has 'numberOfItemsLinked' virtual items); 
 	LinkedDataVectorBase(const VectorBase<T>& vector, Index startPosition, Index numberOfItemsLinked) : VectorBase<T>()
 	{
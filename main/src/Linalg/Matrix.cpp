@@ -85,7 +85,7 @@
 // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
 //! Compute matrix inverse (internal function, needs memory allocation and may be slower than external functions - Eigen, etc.)
-//  NOT Threadsafe!
+//  for solution of linear systems, use GeneralMatrixEXUdense (LU factorization) instead of inverse
 template<typename T>
 bool MatrixBase<T>::Invert()
 {
@@ -94,7 +94,7 @@ bool MatrixBase<T>::Invert()
 	//throw EXUexception("MatrixBase::Invert(): only valid for quadratic matrices");
 	CHECKandTHROW(numberOfColumns == numberOfRows && data != NULL, "MatrixBase::Invert(): only valid for quadratic matrices");
 
-	static ResizableMatrix m; //memory allocation only once, if size does not change; not THREAD safe!
+	static thread_local ResizableMatrix m; //memory allocation only once per thread, if size does not change
 
 	//Insert identity-matrix on left-hand-side
 	m.SetScalarMatrix(numberOfRows, 1.); //set unit matrix
@@ -44,6 +44,7 @@
 
 #include "Utilities/ReleaseAssert.h"
 #include "Utilities/BasicDefinitions.h"
+#include "Linalg/SimdKernels.h"
 
 #ifdef __EXUDYN_RUNTIME_CHECKS__
 extern Index matrix_new_counts; //global counter of item allocations; is increased every time a new is called
@@ -512,6 +513,7 @@ public:
 			"operator*(Matrix,TVector): Size mismatch");
 
 		VectorBase<T> result(matrix.NumberOfRows());
+		if (EXUsimd::MultMatrixVector(matrix.GetDataPointer(), matrix.NumberOfRows(), matrix.NumberOfColumns(), vector.GetDataPointer(), result.GetDataPointer())) { return result; }
 
 		for (Index i = 0; i < result.NumberOfItems(); i++)
 		{
@@ -710,6 +712,8 @@ public:
 
 		for (Index i = 0; i < sm.numberOfRows; i++)
 		{
+			//rows of sm are contiguous in memory of this ==> add rows with SIMD kernel
+			if (EXUsimd::AddVector(&data[(i + row)*numberOfColumns + column], &sm.data[i*sm.numberOfColumns], sm.numberOfColumns)) { continue; }
 			for (Index j = 0; j < sm.numberOfColumns; j++)
 			{
 				data[(i + row)*numberOfColumns + column + j] += sm(i, j);
@@ -848,6 +852,8 @@ namespace EXUmath {
 		Index resultLength = result.NumberOfItems();
 		Index vectorLength = vector.NumberOfItems();
 
+		if (EXUsimd::MultMatrixVector(mm, resultLength, vectorLength, vv, result.GetDataPointer())) { return; }
+
 		for (Index i = 0; i < resultLength; i++)
 		{
 			result[i] = 0;
@@ -874,6 +880,8 @@ namespace EXUmath {
 		Index resultLength = result.NumberOfItems();
 		Index vectorLength = vector.NumberOfItems();
 
+		if (EXUsimd::MultMatrixTransposedVector(mm, vectorLength, resultLength, vv, result.GetDataPointer())) { return; }
+
 		for (Index i = 0; i < resultLength; i++)
 		{
 			Real val = 0;
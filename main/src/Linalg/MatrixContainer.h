@@ -63,6 +63,9 @@ namespace EXUmath {
 		//! add triplet
 		void AddTriplet(const Triplet& triplet) { sparseTriplets.Append(triplet); }
 
+		//! read access to triplets
+		const ResizableArray<Triplet>& GetTriplets() const { return sparseTriplets; }
+
 		//! get number of columns
 		Index NumberOfRows() const { return numberOfRows; }
 		//! get number of rows
@@ -277,6 +280,13 @@ namespace EXUmath {
 			return denseMatrix; 
 		}
 
+		//! this function fails in dense matrix mode!
+		virtual const SparseTripletMatrix& GetInternalSparseTripletMatrix() const
+		{
+			CHECKandTHROW(!useDenseMatrix, "MatrixContainer::GetInternalSparseTripletMatrix failed");
+			return sparseTripletMatrix;
+		}
+
 		//! this function fails in dense matrix mode! implementation is slow!
 		virtual Matrix GetInternalSparseTripletsAsMatrix() const
 		{
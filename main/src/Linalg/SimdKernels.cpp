@@ -0,0 +1,249 @@
+/** ***********************************************************************************************
+* @brief		Implementation of runtime-dispatched SIMD (AVX2) kernels and scalar fallbacks
+* @details		Details:
+					- AVX2 kernels are compiled with function-specific target attribute (GCC/Clang), such that
+					  the module itself does not need to be compiled with -mavx2
+					- no FMA instructions are used, in order to get identical results for AVX2 and scalar kernels
+*
+* @author		agent
+* @date			2026-10-16
+* @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
+*
+************************************************************************************************ */
+
+#include "Linalg/SimdKernels.h"
+
+#if (defined(__x86_64__) || defined(_M_X64)) && defined(DoublePrecision)
+#define EXUDYN_SIMD_AVX2
+#include "Linalg/Use_avx.h"
+#ifdef _MSC_VER
+#include <intrin.h> //__cpuid, _xgetbv
+#define EXUDYN_TARGET_AVX2
+#else
+#define EXUDYN_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace EXUsimd {
+
+	bool AVX2Available()
+	{
+#ifdef EXUDYN_SIMD_AVX2
+#ifdef _MSC_VER
+		int info[4];
+		__cpuid(info, 0);
+		if (info[0] < 7) { return false; }
+		__cpuid(info, 1);
+		bool osxsave = (info[2] & (1 << 27)) != 0;
+		bool avx = (info[2] & (1 << 28)) != 0;
+		if (!osxsave || !avx) { return false; }
+		if ((_xgetbv(0) & 6) != 6) { return false; } //OS saves XMM and YMM registers
+		__cpuidex(info, 7, 0);
+		return (info[1] & (1 << 5)) != 0;
+#else
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("avx2") != 0;
+#endif
+#else
+		return false;
+#endif
+	}
+
+	bool useSIMD = AVX2Available();
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	//scalar kernels
+
+	void AddVectorScalar(Real* a, const Real* b, Index n)
+	{
+		for (Index i = 0; i < n; i++)
+		{
+			a[i] += b[i];
+		}
+	}
+
+	Real L2NormSquaredScalar(const Real* a, Index n)
+	{
+		//16 partial sums, corresponding to 4 AVX2 registers with 4 lanes each
+		Real s[16];
+		for (Index k = 0; k < 16; k++) { s[k] = 0.; }
+		Index i = 0;
+		for (; i + 16 <= n; i += 16)
+		{
+			for (Index k = 0; k < 16; k++) { s[k] += a[i + k] * a[i + k]; }
+		}
+		Real lane[4];
+		for (Index k = 0; k < 4; k++) { lane[k] = (s[k] + s[k + 4]) + (s[k + 8] + s[k + 12]); }
+		Real result = (lane[0] + lane[1]) + (lane[2] + lane[3]);
+		for (; i < n; i++) { result += a[i] * a[i]; }
+		return result;
+	}
+
+	void MultMatrixVectorScalar(const Real* m, Index rows, Index columns, const Real* v, Real* result)
+	{
+		for (Index i = 0; i < rows; i++)
+		{
+			Real val = 0.;
+			const Real* mr = &m[i*columns];
+			for (Index j = 0; j < columns; j++)
+			{
+				val += mr[j] * v[j];
+			}
+			result[i] = val;
+		}
+	}
+
+	void MultMatrixTransposedVectorScalar(const Real* m, Index rows, Index columns, const Real* v, Real* result)
+	{
+		for (Index j = 0; j < columns; j++)
+		{
+			Real val = 0.;
+			const Real* mc = &m[j];
+			for (Index i = 0; i < rows; i++)
+			{
+				val += *mc * v[i];
+				mc += columns;
+			}
+			result[j] = val;
+		}
+	}
+
+#ifdef EXUDYN_SIMD_AVX2
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	//AVX2 kernels
+
+	EXUDYN_TARGET_AVX2 void AddVectorAVX2(Real* a, const Real* b, Index n)
+	{
+		Index i = 0;
+		for (; i + AVXRealSize <= n; i += AVXRealSize)
+		{
+			_mm256_storeu_pd(&a[i], _mm_add_(_mm_load_u(&a[i]), _mm_load_u(&b[i])));
+		}
+		for (; i < n; i++) { a[i] += b[i]; }
+	}
+
+	EXUDYN_TARGET_AVX2 Real L2NormSquaredAVX2(const Real* a, Index n)
+	{
+		//4 independent registers; lanes correspond to partial sums in L2NormSquaredScalar
+		PReal sum0 = _mm_setr_zero_();
+		PReal sum1 = _mm_setr_zero_();
+		PReal sum2 = _mm_setr_zero_();
+		PReal sum3 = _mm_setr_zero_();
+		Index i = 0;
+		for (; i + 4 * AVXRealSize <= n; i += 4 * AVXRealSize)
+		{
+			PReal x0 = _mm_load_u(&a[i]);
+			PReal x1 = _mm_load_u(&a[i + AVXRealSize]);
+			PReal x2 = _mm_load_u(&a[i + 2 * AVXRealSize]);
+			PReal x3 = _mm_load_u(&a[i + 3 * AVXRealSize]);
+			sum0 = _mm_add_(sum0, _mm_mul_(x0, x0));
+			sum1 = _mm_add_(sum1, _mm_mul_(x1, x1));
+			sum2 = _mm_add_(sum2, _mm_mul_(x2, x2));
+			sum3 = _mm_add_(sum3, _mm_mul_(x3, x3));
+		}
+		Real lane[AVXRealSize];
+		_mm256_storeu_pd(lane, _mm_add_(_mm_add_(sum0, sum1), _mm_add_(sum2, sum3)));
+		Real result = (lane[0] + lane[1]) + (lane[2] + lane[3]);
+		for (; i < n; i++) { result += a[i] * a[i]; }
+		return result;
+	}
+
+	EXUDYN_TARGET_AVX2 void MultMatrixVectorAVX2(const Real* m, Index rows, Index columns, const Real* v, Real* result)
+	{
+		//4 rows are computed at once; 4x4 blocks are transposed in registers, such that
+		//  each row is summed up sequentially (identical to scalar kernel)
+		Index i = 0;
+		for (; i + AVXRealSize <= rows; i += AVXRealSize)
+		{
+			const Real* m0 = &m[i*columns];
+			const Real* m1 = m0 + columns;
+			const Real* m2 = m1 + columns;
+			const Real* m3 = m2 + columns;
+			PReal sum = _mm_setr_zero_();
+			Index j = 0;
+			for (; j + AVXRealSize <= columns; j += AVXRealSize)
+			{
+				PReal r0 = _mm_load_u(&m0[j]);
+				PReal r1 = _mm_load_u(&m1[j]);
+				PReal r2 = _mm_load_u(&m2[j]);
+				PReal r3 = _mm_load_u(&m3[j]);
+				PReal t0 = _mm256_unpacklo_pd(r0, r1); //m0[j]  , m1[j]  , m0[j+2], m1[j+2]
+				PReal t1 = _mm256_unpackhi_pd(r0, r1); //m0[j+1], m1[j+1], m0[j+3], m1[j+3]
+				PReal t2 = _mm256_unpacklo_pd(r2, r3);
+				PReal t3 = _mm256_unpackhi_pd(r2, r3);
+				sum = _mm_add_(sum, _mm_mul_(_mm256_permute2f128_pd(t0, t2, 0x20), _mm_set1_(v[j])));	  //column j
+				sum = _mm_add_(sum, _mm_mul_(_mm256_permute2f128_pd(t1, t3, 0x20), _mm_set1_(v[j + 1]))); //column j+1
+				sum = _mm_add_(sum, _mm_mul_(_mm256_permute2f128_pd(t0, t2, 0x31), _mm_set1_(v[j + 2]))); //column j+2
+				sum = _mm_add_(sum, _mm_mul_(_mm256_permute2f128_pd(t1, t3, 0x31), _mm_set1_(v[j + 3]))); //column j+3
+			}
+			for (; j < columns; j++)
+			{
+				sum = _mm_add_(sum, _mm_mul_(_mm_setr_(m0[j], m1[j], m2[j], m3[j]), _mm_set1_(v[j])));
+			}
+			_mm256_storeu_pd(&result[i], sum);
+		}
+		if (i < rows)
+		{
+			MultMatrixVectorScalar(&m[i*columns], rows - i, columns, v, &result[i]);
+		}
+	}
+
+	EXUDYN_TARGET_AVX2 void MultMatrixTransposedVectorAVX2(const Real* m, Index rows, Index columns, const Real* v, Real* result)
+	{
+		//columns are processed in blocks of 16 (4 registers), which are summed up row by row (identical to scalar kernel)
+		const Index blockSize = 4 * AVXRealSize;
+		Index j = 0;
+		for (; j + blockSize <= columns; j += blockSize)
+		{
+			PReal sum0 = _mm_setr_zero_();
+			PReal sum1 = _mm_setr_zero_();
+			PReal sum2 = _mm_setr_zero_();
+			PReal sum3 = _mm_setr_zero_();
+			const Real* mr = &m[j];
+			for (Index i = 0; i < rows; i++)
+			{
+				PReal vi = _mm_set1_(v[i]);
+				sum0 = _mm_add_(sum0, _mm_mul_(_mm_load_u(mr), vi));
+				sum1 = _mm_add_(sum1, _mm_mul_(_mm_load_u(mr + AVXRealSize), vi));
+				sum2 = _mm_add_(sum2, _mm_mul_(_mm_load_u(mr + 2 * AVXRealSize), vi));
+				sum3 = _mm_add_(sum3, _mm_mul_(_mm_load_u(mr + 3 * AVXRealSize), vi));
+				mr += columns;
+			}
+			_mm256_storeu_pd(&result[j], sum0);
+			_mm256_storeu_pd(&result[j + AVXRealSize], sum1);
+			_mm256_storeu_pd(&result[j + 2 * AVXRealSize], sum2);
+			_mm256_storeu_pd(&result[j + 3 * AVXRealSize], sum3);
+		}
+		for (; j + AVXRealSize <= columns; j += AVXRealSize)
+		{
+			PReal sum = _mm_setr_zero_();
+			const Real* mr = &m[j];
+			for (Index i = 0; i < rows; i++)
+			{
+				sum = _mm_add_(sum, _mm_mul_(_mm_load_u(mr), _mm_set1_(v[i])));
+				mr += columns;
+			}
+			_mm256_storeu_pd(&result[j], sum);
+		}
+		for (; j < columns; j++)
+		{
+			Real val = 0.;
+			const Real* mc = &m[j];
+			for (Index i = 0; i < rows; i++)
+			{
+				val += *mc * v[i];
+				mc += columns;
+			}
+			result[j] = val;
+		}
+	}
+
+#else
+	//no AVX2 available for this platform/precision; useSIMD is false and kernels are never called by dispatch functions
+	void AddVectorAVX2(Real* a, const Real* b, Index n) { AddVectorScalar(a, b, n); }
+	Real L2NormSquaredAVX2(const Real* a, Index n) { return L2NormSquaredScalar(a, n); }
+	void MultMatrixVectorAVX2(const Real* m, Index rows, Index columns, const Real* v, Real* result) { MultMatrixVectorScalar(m, rows, columns, v, result); }
+	void MultMatrixTransposedVectorAVX2(const Real* m, Index rows, Index columns, const Real* v, Real* result) { MultMatrixTransposedVectorScalar(m, rows, columns, v, result); }
+#endif
+
+} //namespace EXUsimd
@@ -0,0 +1,92 @@
+/** ***********************************************************************************************
+* @brief		Runtime-dispatched SIMD (AVX2) kernels for hot Vector/Matrix operations
+* @details		Details:
+					- kernels work on raw (row-major) Real arrays and are called by VectorBase and EXUmath matrix-vector functions
+					- the AVX2 version is chosen at runtime, if the CPU supports AVX2 and useSIMD is true; otherwise the scalar fallback is used
+					- only double precision is vectorized; for other types and for small sizes (< minimumSize) the calling scalar loops are used
+					- AVX2 and scalar kernels use the same order of floating point operations (no FMA),
+					  therefore results do not depend on the CPU or on useSIMD
+					- this header does not include immintrin.h; intrinsics (Use_avx.h) are only used in SimdKernels.cpp
+*
+* @author		agent
+* @date			2026-10-16
+* @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
+*
+************************************************************************************************ */
+#ifndef SIMDKERNELS__H
+#define SIMDKERNELS__H
+
+#include "Utilities/BasicDefinitions.h"
+
+namespace EXUsimd {
+
+	//! alignment (in bytes) of memory allocated by VectorBase; 32 bytes = one AVX2 register (4 doubles)
+	const Index memoryAlignment = 32;
+
+	//! minimum number of items in vector operations for SIMD kernels; smaller operations use the scalar loops of the vector/matrix classes
+	const Index minimumSize = 16;
+
+	//! global switch for SIMD kernels; initialized with AVX2Available(); set false to force scalar fallback (e.g. for benchmarks)
+	extern bool useSIMD;
+
+	//! returns true, if the CPU supports AVX2 (runtime check) and the AVX2 kernels have been compiled in
+	bool AVX2Available();
+
+	//! scalar fallback kernels; same order of operations as AVX2 kernels
+	void AddVectorScalar(Real* a, const Real* b, Index n);											//!< a += b
+	Real L2NormSquaredScalar(const Real* a, Index n);												//!< sum of a[i]^2, using 16 partial sums
+	void MultMatrixVectorScalar(const Real* m, Index rows, Index columns, const Real* v, Real* result);				//!< result = m*v
+	void MultMatrixTransposedVectorScalar(const Real* m, Index rows, Index columns, const Real* v, Real* result);	//!< result = m^T*v
+
+	//! AVX2 kernels; must only be called if AVX2Available() is true
+	void AddVectorAVX2(Real* a, const Real* b, Index n);
+	Real L2NormSquaredAVX2(const Real* a, Index n);
+	void MultMatrixVectorAVX2(const Real* m, Index rows, Index columns, const Real* v, Real* result);
+	void MultMatrixTransposedVectorAVX2(const Real* m, Index rows, Index columns, const Real* v, Real* result);
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	//dispatch functions: return true, if operation has been performed by SIMD kernel;
+	//  for false, the caller performs the operation with its own (scalar) loop;
+	//  templates catch all non-Real types (float, Index, ...), which are never vectorized
+	template<typename T> inline bool AddVector(T* a, const T* b, Index n) { return false; }
+	template<typename T> inline bool L2NormSquared(const T* a, Index n, T& result) { return false; }
+	template<typename T> inline bool MultMatrixVector(const T* m, Index rows, Index columns, const T* v, T* result) { return false; }
+	template<typename T> inline bool MultMatrixTransposedVector(const T* m, Index rows, Index columns, const T* v, T* result) { return false; }
+
+#ifdef DoublePrecision
+	//! a += b for n items
+	inline bool AddVector(Real* a, const Real* b, Index n)
+	{
+		if (!useSIMD || n < minimumSize) { return false; }
+		AddVectorAVX2(a, b, n);
+		return true;
+	}
+
+	//! result = sum of squared items of a; summation order differs from sequential loop (16 partial sums)
+	inline bool L2NormSquared(const Real* a, Index n, Real& result)
+	{
+		if (n < minimumSize) { return false; }
+		result = useSIMD ? L2NormSquaredAVX2(a, n) : L2NormSquaredScalar(a, n);
+		return true;
+	}
+
+	//! result = m*v, m being a row-major rows x columns matrix
+	inline bool MultMatrixVector(const Real* m, Index rows, Index columns, const Real* v, Real* result)
+	{
+		if (!useSIMD || rows < 4 || columns < 4 || rows*columns < minimumSize) { return false; }
+		MultMatrixVectorAVX2(m, rows, columns, v, result);
+		return true;
+	}
+
+	//! result = m^T*v, m being a row-major rows x columns matrix
+	inline bool MultMatrixTransposedVector(const Real* m, Index rows, Index columns, const Real* v, Real* result)
+	{
+		if (!useSIMD || columns < 4 || rows*columns < minimumSize) { return false; }
+		MultMatrixTransposedVectorAVX2(m, rows, columns, v, result);
+		return true;
+	}
+#endif
+
+} //namespace EXUsimd
+
+#endif
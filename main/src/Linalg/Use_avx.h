@@ -109,6 +109,8 @@
 // operators for AVX2 & AVX512 
 // note: in case of AVX2-DoublePrecision, AVX2 intrinsics in simd.hpp is deactivated and the instructions below will be used by ngs
 // note: in case of AVX2-SinglePrecision and AVX512, the AVX2-DoublePrecision Intrinsics will be activated in simd.hpp for ngs
+// note: GCC and Clang define __m256d as built-in vector type, which already provides these operators (and does not allow overloading)
+#ifdef _MSC_VER
 INLINE PReal operator- (PReal a) { return _mm_xor_(a, _mm_set1_(-0.0)); }
 INLINE PReal operator+ (PReal a, PReal b) { return _mm_add_(a, b); }
 INLINE PReal operator- (PReal a, PReal b) { return _mm_sub_(a, b); }
@@ -120,6 +122,7 @@ INLINE PReal operator+= (PReal &a, PReal b) { return a = a + b; }
 INLINE PReal operator-= (PReal &a, PReal b) { return a = a - b; }
 INLINE PReal operator*= (PReal &a, PReal b) { return a = a*b; }
 INLINE PReal operator/= (PReal &a, PReal b) { return a = a / b; }
+#endif //_MSC_VER
 
 
 #endif
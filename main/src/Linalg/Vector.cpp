@@ -31,6 +31,15 @@ Index matrix_new_counts = 0; //global counter of item allocations; is increased
 Index matrix_delete_counts = 0; //global counter of item deallocations; is increased every time a delete is called
 #endif
 
+Index GetLinalgAllocationCount()
+{
+#ifdef __EXUDYN_RUNTIME_CHECKS__
+	return array_new_counts + vector_new_counts + matrix_new_counts;
+#else
+	return 0;
+#endif
+}
+
 bool linalgPrintUsePythonFormat = true; //!< true: use python format for output of vectors and matrices; false: use matlab format
 
 //! add two vectors, result = v1+v2 (for each component)
@@ -40,6 +40,7 @@
 //#include <stdlib.h> //only works in MSVC for initialization with std::vector
 #include <array>
 #include <vector>
+#include <new> //for aligned new (std::align_val_t)
 
 //#include <cmath> //for sqrt
 #include <utility> //for sqrt
@@ -47,12 +48,17 @@
 //#include "Utilities/ReleaseAssert.h"
 //#include "Utilities/BasicDefinitions.h" //defines Real
 #include "Utilities/BasicFunctions.h"   //for Minimum
+#include "Linalg/SimdKernels.h"          //for SIMD kernels and memory alignment
 
 #ifdef __EXUDYN_RUNTIME_CHECKS__
 extern Index vector_new_counts; //global counter of item allocations; is increased every time a new is called
 extern Index vector_delete_counts; //global counter of item deallocations; is increased every time a delete is called
 #endif
 
+//! total number of allocations of arrays, vectors and matrices (array_new_counts+vector_new_counts+matrix_new_counts);
+//! always 0, if __EXUDYN_RUNTIME_CHECKS__ is not defined; used for allocation statistics of solvers
+Index GetLinalgAllocationCount();
+
 
 template <typename T, Index dataSize> class SlimVectorBase;
 template <typename T> class LinkedDataVectorBase;
@@ -138,13 +144,18 @@ public:
 
 protected:
     //! allocate memory if numberOfRealsInit!=0; set data to allocated array of Reals or to nullptr
+    //! memory is aligned to EXUsimd::memoryAlignment for SIMD kernels (if aligned new is available)
     virtual void AllocateMemory(Index numberOfRealsInit)
     {
         numberOfItems = numberOfRealsInit;
         if (numberOfItems == 0) { data = nullptr; }//for case that list is zero length? ==> TEST CASE
         else
         {
+#ifdef __cpp_aligned_new
+            data = new (std::align_val_t(EXUsimd::memoryAlignment)) T[numberOfItems];
+#else
             data = new T[numberOfItems];
+#endif
 #ifdef __EXUDYN_RUNTIME_CHECKS__
 			vector_new_counts++;
 #endif
@@ -156,7 +167,12 @@ protected:
     {
         if (data != nullptr)
         {
+#ifdef __cpp_aligned_new
+            //items are only numeric types (Real, float, Index), which need no destructor call
+            ::operator delete[](data, std::align_val_t(EXUsimd::memoryAlignment));
+#else
             delete[] data;
+#endif
             data = nullptr;
 #ifdef __EXUDYN_RUNTIME_CHECKS__
 			vector_delete_counts++;
@@ -298,6 +314,8 @@ public:
     VectorBase& operator+=(const VectorBase& v)
     {
 		CHECKandTHROW((NumberOfItems() == v.NumberOfItems()), "VectorBase::operator+=: incompatible size of vectors");
+		if (EXUsimd::AddVector(GetDataPointer(), v.GetDataPointer(), NumberOfItems())) { return *this; }
+
         Index cnt = 0;
         for (auto item : v) {
             (*this)[cnt++] += item;
@@ -418,10 +436,12 @@ public:
 	}
 
 
-    //! returns the sum of squared components (v[0]^2 + v[1]^2 + v[2]^2 ....)
+    //! returns the sum of squared components (v[0]^2 + v[1]^2 + v[2]^2 ....); uses SIMD kernel for large vectors
     T GetL2NormSquared() const
     {
         T result = 0.;
+		if (EXUsimd::L2NormSquared(GetDataPointer(), NumberOfItems(), result)) { return result; }
+
         for (auto item : *this) { result += item * item; }
         return result;
     }
@@ -22,6 +22,7 @@
 //++++++++++++++++
 
 #include <functional>					//for std::invoke
+#include <algorithm>					//for std::sort
 #include "Main/CSystemData.h"			//Basics, Vector/Array, OutputVariable, CData, Material, Body, Node, Marker, Load
 #include "Main/CSystem.h"	
 
@@ -29,11 +30,19 @@
 #include "Linalg/LinearSolver.h" //for GeneralMatrixEXUdense
 #include "Main/OutputVariable.h" //for GeneralMatrixEXUdense
 #include "Autogenerated/CSensorSuperElement.h" //for sensor integrity checks
+#include "Autogenerated/CObjectConnectorSpringDamper.h" //for batched computation
+#include "Autogenerated/CObjectGround.h" //for batched computation
+#include "Autogenerated/CMarkerNodePosition.h" //for batched computation
+#include "Autogenerated/CMarkerBodyPosition.h" //for batched computation
 
 #include "Utilities/TimerStructure.h" //for local CPU time measurement
 
-//#define USE_AUTODIFF
-
+//! return true, if object adds its ODE2 jacobian directly to the system jacobian (JacobianType::ODE2_ODE2_sparse), e.g., for large sparse matrices
+inline bool AddsJacobianODE2Directly(const CObject* object, bool velocityLevel)
+{
+	Index jacobianType = (Index)object->GetAvailableJacobians();
+	return (jacobianType & JacobianType::ODE2_ODE2_sparse) && (jacobianType & (velocityLevel ? JacobianType::ODE2_ODE2_t_function : JacobianType::ODE2_ODE2_function));
+}
 
 //! Prepare a newly created System of nodes, objects, loads, ... for computation
 void CSystem::Assemble(const MainSystem& mainSystem)
@@ -48,6 +57,7 @@ void CSystem::Assemble(const MainSystem& mainSystem)
 		//pout << "                        ... ok\n";
 		AssembleCoordinates(mainSystem);
 		AssembleLTGLists(mainSystem);
+		AssembleBatchedObjectData(mainSystem);
 		AssembleInitializeSystemCoordinates(mainSystem); //mainSystem needed for initial displacements
 
 		//now system is consistent and can safely be drawn
@@ -647,6 +657,8 @@ void CSystem::AssembleLTGLists(const MainSystem& mainSystem)
 		listAE.Append(ltgListAE);
 		listData.Append(ltgListData);
 	}
+	parallelComputationData.objectColoringValid = false; //coloring depends on ltg lists
+	compressedJacobianData.coloringValid = false;
 	//pout << "local to global ODE2 Indices:\n" << listODE2 << "\n\n";
 	//pout << "local to global ODE1 Indices:\n" << listODE1 << "\n\n";
 	//pout << "local to global AE Indices:\n" << listAE << "\n\n";
@@ -654,6 +666,93 @@ void CSystem::AssembleLTGLists(const MainSystem& mainSystem)
 }
 
 
+//! check if marker is a position marker on a point node, mass point or ground, which can be used in batched computation;
+//! coordinate = global index of first node ODE2 coordinate (InvalidIndex for ground), dimension = number of node coordinates (0 for ground),
+//! reference = node reference coordinates or ground reference position, localPosition = marker local position (nullptr for MarkerNodePosition)
+bool GetBatchedPositionMarker(const MainSystem& mainSystem, const CSystemData& cSystemData, Index markerNumber,
+	Index& coordinate, Index& dimension, const Real*& reference, const Real*& localPosition)
+{
+	const MainSystemData& mainSystemData = mainSystem.GetMainSystemData();
+	STDstring markerType = mainSystemData.GetMainMarkers()[markerNumber]->GetTypeName();
+	Index nodeNumber = EXUstd::InvalidIndex;
+	localPosition = nullptr;
+
+	if (markerType == "NodePosition")
+	{
+		nodeNumber = ((const CMarkerNodePosition*)cSystemData.GetCMarkers()[markerNumber])->GetParameters().nodeNumber;
+	}
+	else if (markerType == "BodyPosition")
+	{
+		const CMarkerBodyPosition* marker = (const CMarkerBodyPosition*)cSystemData.GetCMarkers()[markerNumber];
+		Index bodyNumber = marker->GetParameters().bodyNumber;
+		STDstring bodyType = mainSystemData.GetMainObjects()[bodyNumber]->GetTypeName();
+		localPosition = marker->GetParameters().localPosition.GetDataPointer();
+
+		if (bodyType == "Ground")
+		{
+			coordinate = EXUstd::InvalidIndex;
+			dimension = 0;
+			reference = ((const CObjectGround*)cSystemData.GetCObjects()[bodyNumber])->GetParameters().referencePosition.GetDataPointer();
+			return true;
+		}
+		else if (bodyType == "MassPoint" || bodyType == "MassPoint2D")
+		{
+			nodeNumber = cSystemData.GetCObjects()[bodyNumber]->GetNodeNumber(0);
+		}
+	}
+	if (nodeNumber == EXUstd::InvalidIndex) { return false; }
+
+	STDstring nodeType = mainSystemData.GetMainNodes()[nodeNumber]->GetTypeName();
+	if (nodeType != "Point" && nodeType != "Point2D") { return false; }
+
+	const CNodeODE2* node = (const CNodeODE2*)cSystemData.GetCNodes()[nodeNumber];
+	coordinate = node->GetGlobalODE2CoordinateIndex();
+	dimension = node->GetNumberOfODE2Coordinates();
+	reference = node->GetReferenceCoordinateVector().GetDataPointer(); //links to node parameters
+	return true;
+}
+
+//! build lists of objects for batched computation of ODE2RHS (see BatchedObjectData); called after ltg lists are built
+void CSystem::AssembleBatchedObjectData(const MainSystem& mainSystem)
+{
+	BatchedObjectData& bData = batchedObjectData;
+	bData.Reset();
+
+	const ResizableArray<CObject*>& objects = cSystemData.GetCObjects();
+	for (Index j = 0; j < objects.NumberOfItems(); j++)
+	{
+		STDstring objectType = mainSystem.GetMainSystemData().GetMainObjects()[j]->GetTypeName();
+		Index batchIndex = EXUstd::InvalidIndex;
+
+		if (objectType == "MassPoint" || objectType == "MassPoint2D")
+		{
+			batchIndex = BatchedObjectData::zeroODE2RHS;
+		}
+		else if (objectType == "ConnectorSpringDamper")
+		{
+			const CObjectConnectorSpringDamper* connector = (const CObjectConnectorSpringDamper*)objects[j];
+			Index coordinate[2];
+			Index dimension[2];
+			const Real* reference[2];
+			const Real* localPosition[2];
+
+			if (GetBatchedPositionMarker(mainSystem, cSystemData, connector->GetMarkerNumbers()[0], coordinate[0], dimension[0], reference[0], localPosition[0]) &&
+				GetBatchedPositionMarker(mainSystem, cSystemData, connector->GetMarkerNumbers()[1], coordinate[1], dimension[1], reference[1], localPosition[1]))
+			{
+				batchIndex = bData.springDampers.Append(connector);
+				for (Index i = 0; i < 2; i++)
+				{
+					bData.markerCoordinate[i].Append(coordinate[i]);
+					bData.markerDimension[i].Append(dimension[i]);
+					bData.markerReference[i].Append(reference[i]);
+					bData.markerLocalPosition[i].Append(localPosition[i]);
+				}
+			}
+		}
+		bData.objectBatchIndex.Append(batchIndex);
+	}
+}
+
 //! build ltg-coordinate lists for object with 'objectIndex' and set indices in ltg lists
 void CSystem::AssembleObjectLTGLists(Index objectIndex, ArrayIndex& ltgListODE2, ArrayIndex& ltgListODE1,
 	ArrayIndex& ltgListAE, ArrayIndex& ltgListData)
@@ -932,8 +1031,15 @@ void CSystem::AssembleInitializeSystemCoordinates(const MainSystem& mainSystem)
 // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 // CSystem computation functions
 // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//! return true, if body with constant / state-dependent mass matrix is selected
+inline bool IsMassMatrixBodySelected(const CObjectBody& body, MassMatrixBodies bodies)
+{
+	if (bodies == MassMatrixBodies::All) { return true; }
+	return body.HasConstantMassMatrix() == (bodies == MassMatrixBodies::Constant);
+}
+
 //! compute system massmatrix; massmatrix must have according size
-void CSystem::ComputeMassMatrix(TemporaryComputationData& temp, GeneralMatrix& massMatrix)
+void CSystem::ComputeMassMatrix(TemporaryComputationData& temp, GeneralMatrix& massMatrix, MassMatrixBodies bodies)
 {
 	//size needs to be set accordingly in the caller function; components are addd to massMatrix!
 
@@ -946,7 +1052,7 @@ void CSystem::ComputeMassMatrix(TemporaryComputationData& temp, GeneralMatrix& m
 		if ((Index)object.GetType() & (Index)CObjectType::Body)
 		{
 			ArrayIndex& ltg = cSystemData.GetLocalToGlobalODE2()[j];
-			if (ltg.NumberOfItems() != 0) //to exclude bodies attached to ground nodes
+			if (ltg.NumberOfItems() != 0 && IsMassMatrixBodySelected((CObjectBody&)object, bodies)) //to exclude bodies attached to ground nodes
 			{
 				((CObjectBody&)object).ComputeMassMatrix(temp.localMass);
 
@@ -957,6 +1063,52 @@ void CSystem::ComputeMassMatrix(TemporaryComputationData& temp, GeneralMatrix& m
 
 }
 
+//! compute M*x body by body and add to result; result must have size nODE2
+void CSystem::ComputeMassMatrixTimesVector(TemporaryComputationData& temp, const Vector& x, Vector& result, MassMatrixBodies bodies)
+{
+	for (Index j = 0; j < cSystemData.GetCObjects().NumberOfItems(); j++)
+	{
+		CObject& object = *(cSystemData.GetCObjects()[j]);
+
+		if ((Index)object.GetType() & (Index)CObjectType::Body)
+		{
+			const ArrayIndex& ltg = cSystemData.GetLocalToGlobalODE2()[j];
+			if (ltg.NumberOfItems() != 0 && IsMassMatrixBodySelected((CObjectBody&)object, bodies))
+			{
+				((CObjectBody&)object).ComputeMassMatrix(temp.localMass);
+
+				Index n = ltg.NumberOfItems();
+				for (Index i = 0; i < n; i++)
+				{
+					Real value = 0.;
+					for (Index k = 0; k < n; k++)
+					{
+						value += temp.localMass(i, k) * x[ltg[k]];
+					}
+					result[ltg[i]] += value;
+				}
+			}
+		}
+	}
+}
+
+bool CSystem::HasConstantMassMatrix() const
+{
+	for (Index j = 0; j < cSystemData.GetCObjects().NumberOfItems(); j++)
+	{
+		const CObject& object = *(cSystemData.GetCObjects()[j]);
+
+		if ((Index)object.GetType() & (Index)CObjectType::Body)
+		{
+			if (cSystemData.GetLocalToGlobalODE2()[j].NumberOfItems() != 0 && !((const CObjectBody&)object).HasConstantMassMatrix())
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
 
 Index TScomputeODE2RHSobject;
 TimerStructureRegistrator TSRcomputeODE2RHSobject("computeODE2RHSobject", TScomputeODE2RHSobject, globalTimers);
@@ -970,6 +1122,13 @@ TimerStructureRegistrator TSRcomputeLoads("computeLoads", TScomputeLoads, global
 //! compute right-hand-side (RHS) of second order ordinary differential equations (ODE) for every object (used in numerical differentiation and in RHS computation)
 //! return true, if object has localODE2Rhs, false otherwise
 bool CSystem::ComputeObjectODE2RHS(TemporaryComputationData& temp, CObject* object, Vector& localODE2Rhs)
+{
+	return ComputeObjectODE2RHStemplate<true>(temp, object, localODE2Rhs);
+}
+
+//! compute object RHS; global timers are only used if useGlobalTimers=true (not thread-safe)
+template<bool useGlobalTimers>
+bool CSystem::ComputeObjectODE2RHStemplate(TemporaryComputationData& temp, CObject* object, Vector& localODE2Rhs)
 {
 	//Index i = 0;
 	//std::cout << "ComputeODE2RHS" << i++ << ": " << (Index)object->GetType() << "\n";
@@ -978,9 +1137,9 @@ bool CSystem::ComputeObjectODE2RHS(TemporaryComputationData& temp, CObject* obje
 		//if object is a body, it must have ODE2RHS
 		if ((Index)object->GetType() & (Index)CObjectType::Body)
 		{
-			STARTGLOBALTIMER(TScomputeODE2RHSobject);
+			if (useGlobalTimers) { STARTGLOBALTIMER(TScomputeODE2RHSobject); }
 			object->ComputeODE2RHS(localODE2Rhs);
-			STOPGLOBALTIMER(TScomputeODE2RHSobject);
+			if (useGlobalTimers) { STOPGLOBALTIMER(TScomputeODE2RHSobject); }
 			//pout << "temp.localODE2RHS=" << temp.localODE2RHS << "\n";
 		}
 		else if ((Index)object->GetType() & (Index)CObjectType::Connector)
@@ -989,15 +1148,15 @@ bool CSystem::ComputeObjectODE2RHS(TemporaryComputationData& temp, CObject* obje
 
 			//compute MarkerData for connector:
 			const bool computeJacobian = true;
-			STARTGLOBALTIMER(TScomputeODE2RHSmarkerData);
+			if (useGlobalTimers) { STARTGLOBALTIMER(TScomputeODE2RHSmarkerData); }
 			ComputeMarkerDataStructure(connector, computeJacobian, temp.markerDataStructure);
-			STOPGLOBALTIMER(TScomputeODE2RHSmarkerData);
+			if (useGlobalTimers) { STOPGLOBALTIMER(TScomputeODE2RHSmarkerData); }
 
 			//pout << "ComputeODE2RHS " << i++ << "\n";
 			//Real t = cSystemData.GetCData().currentState.time; //==>done in markerdatastructure
-			STARTGLOBALTIMER(TScomputeODE2RHSconnector);
+			if (useGlobalTimers) { STARTGLOBALTIMER(TScomputeODE2RHSconnector); }
 			connector->ComputeODE2RHS(localODE2Rhs, temp.markerDataStructure);
-			STOPGLOBALTIMER(TScomputeODE2RHSconnector);
+			if (useGlobalTimers) { STOPGLOBALTIMER(TScomputeODE2RHSconnector); }
 
 		}
 		else { CHECKandTHROWstring("CSystem::ComputeODE2RHS(...): object type not implemented"); return false; }
@@ -1012,14 +1171,30 @@ void CSystem::ComputeODE2RHS(TemporaryComputationData& temp, Vector& ode2Rhs)
 {
 	ode2Rhs.SetAll(0.);
 
+	if (parallelComputationData.UseMultithreading())
+	{
+		ComputeODE2RHSmultithreaded(temp, ode2Rhs);
+		ComputeLoads(temp, ode2Rhs);
+		return;
+	}
+
+	bool useBatchedComputation = UseBatchedComputation();
+	if (useBatchedComputation) { ComputeBatchedSpringDamperForces(); }
+
 	for (Index j = 0; j < cSystemData.GetCObjects().NumberOfItems(); j++)
 	{
 		if ((cSystemData.GetCObjects()[j])->IsActive())
 		{
 			//work over bodies, connectors, etc.
 			ArrayIndex& ltgODE2 = cSystemData.GetLocalToGlobalODE2()[j];
+			Index batchIndex = useBatchedComputation ? batchedObjectData.objectBatchIndex[j] : EXUstd::InvalidIndex;
 
-			if (ltgODE2.NumberOfItems() && ComputeObjectODE2RHS(temp, cSystemData.GetCObjects()[j], temp.localODE2RHS))//temp.localODE2RHS))
+			if (batchIndex == BatchedObjectData::zeroODE2RHS) {} //nothing to add
+			else if (batchIndex < batchedObjectData.springDampers.NumberOfItems() && !cSystemData.GetCObjects()[j]->HasUserFunction())
+			{
+				AddBatchedSpringDamperODE2RHS(batchIndex, ltgODE2, ode2Rhs);
+			}
+			else if (ltgODE2.NumberOfItems() && ComputeObjectODE2RHS(temp, cSystemData.GetCObjects()[j], temp.localODE2RHS))//temp.localODE2RHS))
 			{
 				//now add RHS to system vector
 				for (Index k = 0; k < temp.localODE2RHS.NumberOfItems(); k++)
@@ -1034,6 +1209,218 @@ void CSystem::ComputeODE2RHS(TemporaryComputationData& temp, Vector& ode2Rhs)
 	ComputeLoads(temp, ode2Rhs);
 }
 
+//! compute object ODE2RHS with parallelComputationData.numberOfThreads threads and add them to 'ode2Rhs';
+//! every object is computed by exactly one thread into a per-object buffer, which is then added serially in object order;
+//! thus, the result is bit-identical to the serial computation for any number of threads;
+//! objects with python user functions (GIL) are computed serially in the main thread
+void CSystem::ComputeODE2RHSmultithreaded(TemporaryComputationData& temp, Vector& ode2Rhs)
+{
+	ParallelComputationData& pData = parallelComputationData;
+	const ResizableArray<CObject*>& objects = cSystemData.GetCObjects();
+	const ObjectContainer<ArrayIndex>& localToGlobalODE2 = cSystemData.GetLocalToGlobalODE2();
+	Index nObjects = objects.NumberOfItems();
+
+	//compute offsets of objects in buffer; ltg lists may change after Assemble(), therefore always updated
+	pData.objectODE2RHSoffsets.SetNumberOfItems(nObjects + 1);
+	pData.objectODE2RHSsize.SetNumberOfItems(nObjects);
+	Index offset = 0;
+	for (Index j = 0; j < nObjects; j++)
+	{
+		pData.objectODE2RHSoffsets[j] = offset;
+		offset += localToGlobalODE2[j].NumberOfItems();
+	}
+	pData.objectODE2RHSoffsets[nObjects] = offset;
+	pData.objectODE2RHS.SetNumberOfItems(offset);
+
+	bool useBatchedComputation = UseBatchedComputation();
+	if (useBatchedComputation) { ComputeBatchedSpringDamperForces(); }
+
+	std::exception_ptr threadException = nullptr; //exceptions must not leave the parallel region
+
+	STARTGLOBALTIMER(TScomputeODE2RHSobject);
+	#pragma omp parallel for num_threads((int)pData.numberOfThreads) schedule(static)
+	for (int jj = 0; jj < (int)nObjects; jj++)
+	{
+		Index j = (Index)jj;
+		CObject* object = objects[j];
+		pData.objectODE2RHSsize[j] = 0;
+		if (object->IsActive() && !object->HasUserFunction() && localToGlobalODE2[j].NumberOfItems() &&
+			!(useBatchedComputation && batchedObjectData.objectBatchIndex[j] != EXUstd::InvalidIndex))
+		{
+			TemporaryComputationData& threadTemp = *(pData.threadTempData[omp_get_thread_num()]);
+			try
+			{
+				if (ComputeObjectODE2RHStemplate<false>(threadTemp, object, threadTemp.localODE2RHS))
+				{
+					Index jOffset = pData.objectODE2RHSoffsets[j];
+					Index jSize = threadTemp.localODE2RHS.NumberOfItems();
+					CHECKandTHROW(jOffset + jSize <= pData.objectODE2RHSoffsets[j + 1], "CSystem::ComputeODE2RHSmultithreaded: object ODE2RHS size inconsistent with coordinates");
+					for (Index k = 0; k < jSize; k++)
+					{
+						pData.objectODE2RHS[jOffset + k] = threadTemp.localODE2RHS[k];
+					}
+					pData.objectODE2RHSsize[j] = jSize;
+				}
+			}
+			catch (...)
+			{
+				#pragma omp critical
+				{
+					if (!threadException) { threadException = std::current_exception(); }
+				}
+			}
+		}
+	}
+	STOPGLOBALTIMER(TScomputeODE2RHSobject);
+
+	if (threadException) { std::rethrow_exception(threadException); }
+
+	//add object contributions in object order; user function objects are computed here
+	for (Index j = 0; j < nObjects; j++)
+	{
+		const ArrayIndex& ltgODE2 = localToGlobalODE2[j];
+		if (pData.objectODE2RHSsize[j])
+		{
+			Index jOffset = pData.objectODE2RHSoffsets[j];
+			for (Index k = 0; k < pData.objectODE2RHSsize[j]; k++)
+			{
+				ode2Rhs[ltgODE2[k]] -= pData.objectODE2RHS[jOffset + k]; //negative sign ==> stiffness/damping on LHS of equations
+			}
+		}
+		else if (useBatchedComputation && batchedObjectData.objectBatchIndex[j] < batchedObjectData.springDampers.NumberOfItems() && 
+			objects[j]->IsActive() && !objects[j]->HasUserFunction())
+		{
+			AddBatchedSpringDamperODE2RHS(batchedObjectData.objectBatchIndex[j], ltgODE2, ode2Rhs);
+		}
+		else if (objects[j]->IsActive() && objects[j]->HasUserFunction() && ltgODE2.NumberOfItems() && 
+			ComputeObjectODE2RHS(temp, objects[j], temp.localODE2RHS))
+		{
+			for (Index k = 0; k < temp.localODE2RHS.NumberOfItems(); k++)
+			{
+				ode2Rhs[ltgODE2[k]] -= temp.localODE2RHS[k]; //negative sign ==> stiffness/damping on LHS of equations
+			}
+		}
+	}
+}
+
+//! compute forces of all batched spring-dampers into batchedObjectData.force;
+//! operations are the same as in CObjectConnectorSpringDamper::ComputeODE2RHS, giving identical results
+void CSystem::ComputeBatchedSpringDamperForces()
+{
+	BatchedObjectData& bData = batchedObjectData;
+	Index n = bData.springDampers.NumberOfItems();
+	if (n == 0) { return; }
+
+	STARTGLOBALTIMER(TScomputeODE2RHSconnector);
+	const Vector& u = cSystemData.GetCData().currentState.ODE2Coords;
+	const Vector& u_t = cSystemData.GetCData().currentState.ODE2Coords_t;
+
+	for (Index i = 0; i < 3; i++)
+	{
+		bData.relPos[i].SetNumberOfItems(n);
+		bData.relVel[i].SetNumberOfItems(n);
+		bData.force[i].SetNumberOfItems(n);
+	}
+	bData.stiffness.SetNumberOfItems(n);
+	bData.damping.SetNumberOfItems(n);
+	bData.referenceLength.SetNumberOfItems(n);
+	bData.springForce.SetNumberOfItems(n);
+
+	//gather marker positions, velocities and parameters into contiguous arrays:
+	for (Index s = 0; s < n; s++)
+	{
+		Real position[2][3];
+		Real velocity[2][3];
+		for (Index m = 0; m < 2; m++)
+		{
+			Index coordinate = bData.markerCoordinate[m][s];
+			Index dimension = bData.markerDimension[m][s];
+			const Real* reference = bData.markerReference[m][s];
+			const Real* localPosition = bData.markerLocalPosition[m][s];
+			for (Index i = 0; i < 3; i++)
+			{
+				if (dimension == 0) //ground
+				{
+					position[m][i] = localPosition[i] + reference[i];
+					velocity[m][i] = 0.;
+				}
+				else
+				{
+					if (i < dimension)
+					{
+						position[m][i] = reference[i] + u[coordinate + i];
+						velocity[m][i] = u_t[coordinate + i];
+					}
+					else
+					{
+						position[m][i] = 0.;
+						velocity[m][i] = 0.;
+					}
+					if (localPosition) { position[m][i] += localPosition[i]; }
+				}
+			}
+		}
+		for (Index i = 0; i < 3; i++)
+		{
+			bData.relPos[i][s] = position[1][i] - position[0][i];
+			bData.relVel[i][s] = velocity[1][i] - velocity[0][i];
+		}
+
+		const CObjectConnectorSpringDamperParameters& parameters = bData.springDampers[s]->GetParameters();
+		bool active = parameters.activeConnector;
+		bData.stiffness[s] = active ? parameters.stiffness : 0.;
+		bData.damping[s] = active ? parameters.damping : 0.;
+		bData.referenceLength[s] = parameters.referenceLength;
+		bData.springForce[s] = active ? parameters.force : 0.;
+	}
+
+	//force computation on contiguous arrays (vectorizable):
+	const Real* px = bData.relPos[0].GetDataPointer();
+	const Real* py = bData.relPos[1].GetDataPointer();
+	const Real* pz = bData.relPos[2].GetDataPointer();
+	const Real* vx = bData.relVel[0].GetDataPointer();
+	const Real* vy = bData.relVel[1].GetDataPointer();
+	const Real* vz = bData.relVel[2].GetDataPointer();
+	const Real* stiffness = bData.stiffness.GetDataPointer();
+	const Real* damping = bData.damping.GetDataPointer();
+	const Real* referenceLength = bData.referenceLength.GetDataPointer();
+	const Real* springForce = bData.springForce.GetDataPointer();
+	Real* fx = bData.force[0].GetDataPointer();
+	Real* fy = bData.force[1].GetDataPointer();
+	Real* fz = bData.force[2].GetDataPointer();
+	Index zeroLengthCount = 0;
+
+	for (Index s = 0; s < n; s++)
+	{
+		Real springLength = sqrt(px[s] * px[s] + py[s] * py[s] + pz[s] * pz[s]);
+		zeroLengthCount += (springLength == 0.);
+		Real springLengthInv = (springLength != 0.) ? 1. / springLength : 1.;
+
+		Real nx = springLengthInv * px[s];
+		Real ny = springLengthInv * py[s];
+		Real nz = springLengthInv * pz[s];
+
+		Real force = stiffness[s] * (springLength - referenceLength[s]);
+		force += (damping[s] * (vx[s] * nx + vy[s] * ny + vz[s] * nz)) + springForce[s];
+
+		fx[s] = force * nx;
+		fy[s] = force * ny;
+		fz[s] = force * nz;
+	}
+
+	if (zeroLengthCount)
+	{
+		for (Index s = 0; s < n; s++)
+		{
+			if (bData.springDampers[s]->GetParameters().activeConnector && sqrt(px[s] * px[s] + py[s] * py[s] + pz[s] * pz[s]) == 0.)
+			{
+				SysError("CObjectConnectorSpringDamper::ComputeODE2RHS: springLength = 0");
+			}
+		}
+	}
+	STOPGLOBALTIMER(TScomputeODE2RHSconnector);
+}
+
 //! compute right-hand-side (RHS) of second order ordinary differential equations (ODE) to 'ode2rhs' for ODE2 part
 void CSystem::ComputeLoads(TemporaryComputationData& temp, Vector& ode2Rhs)
 {
@@ -1357,70 +1744,37 @@ void CSystem::NumericalJacobianODE2RHS(TemporaryComputationData& temp, const Num
 
 	if (!numDiff.doSystemWideDifferentiation)
 	{
-		//GeneralMatrixEXUdense mat;
-		//if (jacobianGM.GetSystemMatrixType() != LinearSolverType::EXUdense) { CHECKandTHROWstring("CSystem::NumericalJacobianODE2RHS: illegal LinearSolverType!"); }
-		//ResizableMatrix& jacobian = jacobianGM.GetMatrixEXUdense();
-		ResizableMatrix& localJacobian = temp.localJacobian;
-
 		//size already set by solver: jacobian.SetNumberOfRowsAndColumns(nODE2, nODE2);
-		//NEW: set whole matrix zero
 		//jacobianGM.SetAllZero(); //now done outside
 
-		//this only sets a sub-part to zero:
-		//for (Index i = 0; i < nODE2; i++) {//SetAll(0.) does not work, because jacobian matrix could be larger
-		//	for (Index j = 0; j < nODE2; j++) { jacobian(i, j) = 0.; } }
-
-		//++++++++++++++++++++++++++++++++++++++++++++++++
-
-		for (Index j = 0; j < cSystemData.GetCObjects().NumberOfItems(); j++)
+		if (parallelComputationData.UseMultithreading())
 		{
-			ArrayIndex& ltgODE2 = cSystemData.GetLocalToGlobalODE2()[j];
-			Index nLocalODE2 = ltgODE2.NumberOfItems();
-			f0.SetNumberOfItems(nLocalODE2);
-			f1.SetNumberOfItems(nLocalODE2);
-			CObject* object = cSystemData.GetCObjects()[j];
-
-			if (object->IsActive() && ltgODE2.NumberOfItems())
+			NumericalJacobianODE2RHSmultithreaded(temp, numDiff, f0, f1, jacobianGM, scalarFactor, false);
+		}
+		else
+		{
+			for (Index j = 0; j < cSystemData.GetCObjects().NumberOfItems(); j++)
 			{
-#ifdef USE_AUTODIFF
-				if (object->GetAvailableJacobians() & (JacobianType::ODE2_ODE2_function))
-				{
-					localJacobian.SetNumberOfRowsAndColumns(nLocalODE2, nLocalODE2); //needs not to be initialized, because the matrix is fully computed and then added to jacobianGM
-					temp.localJacobian_t.SetNumberOfRowsAndColumns(nLocalODE2, nLocalODE2); //needs not to be initialized, because the matrix is fully computed and then added to jacobianGM
-					object->ComputeJacobianODE2_ODE2(localJacobian, temp.localJacobian_t);
-					jacobianGM.AddSubmatrix(localJacobian, -1., ltgODE2, ltgODE2); //-1. because in numerical mode, f0-f1 leads to negative sign (RHS ==> LHS)
-				}
-				else 
-#endif
-				if (ComputeObjectODE2RHS(temp, object, f0)) //check if it is a constraint, etc. which is not differentiated for ODE2 jacobian
+				ArrayIndex& ltgODE2 = cSystemData.GetLocalToGlobalODE2()[j];
+				CObject* object = cSystemData.GetCObjects()[j];
+
+				if (object->IsActive() && ltgODE2.NumberOfItems())
 				{
-					localJacobian.SetNumberOfRowsAndColumns(nLocalODE2, nLocalODE2); //needs not to be initialized, because the matrix is fully computed and then added to jacobianGM
-					Real xRefVal = 0;
-					for (Index i = 0; i < nLocalODE2; i++) //differentiate w.r.t. every ltgODE2 coordinate
+					if (AddsJacobianODE2Directly(object, false))
 					{
-						Real& xVal = x[ltgODE2[i]];
-						if (numDiff.addReferenceCoordinatesToEpsilon) { xRefVal = xRef[ltgODE2[i]]; }
-
-						eps = relEps * (EXUstd::Maximum(minCoord, fabs(xVal + xRefVal)));
-
-						xStore = xVal;
-						xVal += eps;
-						ComputeObjectODE2RHS(temp, object, f1);
-						xVal = xStore;
-
-						epsInv = (1. / eps) * scalarFactor;
-
-						for (Index k = 0; k < nLocalODE2; k++)
-						{
-							//use local jacobian:
-							localJacobian(k, i) = epsInv * (f0[k] - f1[k]); //-(f1-f0) == (f0-f1): negative sign, because object ODE2RHS is subtracted from global RHS-vector
-						}
+						object->AddJacobianODE2_ODE2(jacobianGM, -scalarFactor, ltgODE2, false);
+						continue;
 					}
-					jacobianGM.AddSubmatrix(localJacobian, 1., ltgODE2, ltgODE2);
+					Real factor = ComputeObjectJacobianODE2RHS<true>(temp, numDiff, object, ltgODE2, f0, f1, scalarFactor, false);
+					if (factor != 0.) { jacobianGM.AddSubmatrix(temp.localJacobian, factor, ltgODE2, ltgODE2); }
 				}
 			}
 		}
 	}
+	else if (numDiff.compressedSystemWideDifferentiation)
+	{
+		NumericalJacobianODE2RHScompressed(temp, numDiff, f0, f1, jacobianGM, scalarFactor, false);
+	}
 	else
 	{
 		//done in solver: jacobian.SetNumberOfRowsAndColumns(nODE2, nODE2);
@@ -1467,60 +1821,38 @@ void CSystem::NumericalJacobianODE2RHS_t(TemporaryComputationData& temp, const N
 
 	if (!numDiff.doSystemWideDifferentiation)
 	{
-		//size already set by solver: jacobian.SetNumberOfRowsAndColumns(nODE2, nODE2);
-
-		ResizableMatrix& localJacobian_t = temp.localJacobian_t;
-
 		//size already set by solver: jacobian.SetNumberOfRowsAndColumns(nODE2, nODE2);
 		//jacobianGM.SetAllZero(); //now done in caller function
 
-		for (Index j = 0; j < cSystemData.GetCObjects().NumberOfItems(); j++)
+		if (parallelComputationData.UseMultithreading())
 		{
-			ArrayIndex& ltgODE2 = cSystemData.GetLocalToGlobalODE2()[j];
-			Index nLocalODE2 = ltgODE2.NumberOfItems();
-			f0.SetNumberOfItems(nLocalODE2);
-			f1.SetNumberOfItems(nLocalODE2);
-			CObject* object = cSystemData.GetCObjects()[j];
-
-			if (object->IsActive() && ltgODE2.NumberOfItems())
+			NumericalJacobianODE2RHSmultithreaded(temp, numDiff, f0, f1, jacobianGM, scalarFactor, true);
+		}
+		else
+		{
+			for (Index j = 0; j < cSystemData.GetCObjects().NumberOfItems(); j++)
 			{
-#ifdef USE_AUTODIFF
-				if (object->GetAvailableJacobians() & (JacobianType::ODE2_ODE2_t_function))
-				{
-					//temp.localJacobian.SetNumberOfRowsAndColumns(nLocalODE2, nLocalODE2); //needs not to be initialized, because the matrix is fully computed and then added to jacobianGM
-					//localJacobian_t.SetNumberOfRowsAndColumns(nLocalODE2, nLocalODE2); //needs not to be initialized, because the matrix is fully computed and then added to jacobianGM
-					//object->ComputeJacobianODE2_ODE2(temp.localJacobian, localJacobian_t);
-					//jacobianGM.AddSubmatrix(localJacobian_t, -1., ltgODE2, ltgODE2);//-1. because in numerical mode, f0-f1 leads to negative sign (RHS ==> LHS)
-				}
-				else
-#endif
-				if (ComputeObjectODE2RHS(temp, object, f0)) //check if it is a constraint, etc. which is not differentiated for ODE2 jacobian
+				ArrayIndex& ltgODE2 = cSystemData.GetLocalToGlobalODE2()[j];
+				CObject* object = cSystemData.GetCObjects()[j];
+
+				if (object->IsActive() && ltgODE2.NumberOfItems())
 				{
-					localJacobian_t.SetNumberOfRowsAndColumns(nLocalODE2, nLocalODE2); //needs not to be initialized, because the matrix is fully computed and then added to jacobianGM
-					for (Index i = 0; i < nLocalODE2; i++) //differentiate w.r.t. every ltgODE2 coordinate
+					if (AddsJacobianODE2Directly(object, true))
 					{
-						Real& xVal = x[ltgODE2[i]];
-						eps = relEps * (EXUstd::Maximum(minCoord, fabs(xVal)));
-
-						xStore = xVal;
-						xVal += eps;
-						ComputeObjectODE2RHS(temp, object, f1);
-						xVal = xStore;
-
-						epsInv = (1. / eps) * scalarFactor;
-
-						for (Index k = 0; k < nLocalODE2; k++)
-						{
-							//use local jacobian:
-							localJacobian_t(k, i) = epsInv * (f0[k] - f1[k]); //-(f1-f0) == (f0-f1): negative sign, because object ODE2RHS is subtracted from global RHS-vector
-						}
+						object->AddJacobianODE2_ODE2(jacobianGM, -scalarFactor, ltgODE2, true);
+						continue;
 					}
-					jacobianGM.AddSubmatrix(localJacobian_t, 1., ltgODE2, ltgODE2);
+					Real factor = ComputeObjectJacobianODE2RHS<true>(temp, numDiff, object, ltgODE2, f0, f1, scalarFactor, true);
+					if (factor != 0.) { jacobianGM.AddSubmatrix(temp.localJacobian_t, factor, ltgODE2, ltgODE2); }
 				}
 			}
 		}
 
 	}
+	else if (numDiff.compressedSystemWideDifferentiation)
+	{
+		NumericalJacobianODE2RHScompressed(temp, numDiff, f0, f1, jacobianGM, scalarFactor, true);
+	}
 	else
 	{
 		//jacobianGM.SetAllZero(); //now done outside
@@ -1553,6 +1885,353 @@ void CSystem::NumericalJacobianODE2RHS_t(TemporaryComputationData& temp, const N
 	//pout << "ODE2jac_t=" << jacobian << "\n";
 }
 
+//! compute local jacobian of object ODE2RHS w.r.t. ODE2 coordinates into temp.localJacobian (velocityLevel=false) or w.r.t. ODE2_t coordinates into temp.localJacobian_t (velocityLevel=true);
+//! returns the factor to add the local jacobian to the system jacobian or 0, if object has no ODE2 jacobian
+//! the object's coordinates are perturbed in the system state and restored afterwards
+template<bool useGlobalTimers>
+Real CSystem::ComputeObjectJacobianODE2RHS(TemporaryComputationData& temp, const NumericalDifferentiationSettings& numDiff, CObject* object,
+	const ArrayIndex& ltgODE2, Vector& f0, Vector& f1, Real scalarFactor, bool velocityLevel)
+{
+	Real relEps = numDiff.relativeEpsilon;			//relative differentiation parameter
+	Real minCoord = numDiff.minimumCoordinateSize;	//absolute differentiation parameter is limited to this minimum
+	Real eps, epsInv; //coordinate(column)-wise differentiation parameter; depends on size of coordinate
+
+	Vector& x = velocityLevel ? cSystemData.GetCData().currentState.ODE2Coords_t : cSystemData.GetCData().currentState.ODE2Coords; //this is what is differentiated for
+	Vector& xRef = cSystemData.GetCData().referenceState.ODE2Coords;	//reference coordinates; might be important for numerical differentiation
+	Real xStore; //store value of x; avoid roundoff error effects in numerical differentiation
+	ResizableMatrix& localJacobian = velocityLevel ? temp.localJacobian_t : temp.localJacobian;
+
+	Index nLocalODE2 = ltgODE2.NumberOfItems();
+	f0.SetNumberOfItems(nLocalODE2);
+	f1.SetNumberOfItems(nLocalODE2);
+
+	//analytic jacobians: objects return derivative of LHS (K, D), therefore factor -scalarFactor (numerical mode: f0-f1 leads to negative sign)
+	if (object->GetAvailableJacobians() & (velocityLevel ? JacobianType::ODE2_ODE2_t_function : JacobianType::ODE2_ODE2_function))
+	{
+		//jacobians need not to be initialized, because they are fully computed in object and then added to jacobianGM
+		temp.localJacobian.SetNumberOfRowsAndColumns(nLocalODE2, nLocalODE2);
+		temp.localJacobian_t.SetNumberOfRowsAndColumns(nLocalODE2, nLocalODE2);
+		if ((Index)object->GetType() & (Index)CObjectType::Connector)
+		{
+			CObjectConnector* connector = (CObjectConnector*)object;
+			ComputeMarkerDataStructure(connector, true, temp.markerDataStructure);
+			connector->ComputeJacobianODE2_ODE2(temp.localJacobian, temp.localJacobian_t, temp.markerDataStructure);
+		}
+		else
+		{
+			object->ComputeJacobianODE2_ODE2(temp.localJacobian, temp.localJacobian_t);
+		}
+		return -scalarFactor;
+	}
+
+	if (ComputeObjectODE2RHStemplate<useGlobalTimers>(temp, object, f0)) //check if it is a constraint, etc. which is not differentiated for ODE2 jacobian
+	{
+		localJacobian.SetNumberOfRowsAndColumns(nLocalODE2, nLocalODE2); //needs not to be initialized, because the matrix is fully computed and then added to jacobianGM
+		Real xRefVal = 0;
+		for (Index i = 0; i < nLocalODE2; i++) //differentiate w.r.t. every ltgODE2 coordinate
+		{
+			Real& xVal = x[ltgODE2[i]];
+			if (!velocityLevel && numDiff.addReferenceCoordinatesToEpsilon) { xRefVal = xRef[ltgODE2[i]]; }
+
+			eps = relEps * (EXUstd::Maximum(minCoord, fabs(xVal + xRefVal)));
+
+			xStore = xVal;
+			xVal += eps;
+			ComputeObjectODE2RHStemplate<useGlobalTimers>(temp, object, f1);
+			xVal = xStore;
+
+			epsInv = (1. / eps) * scalarFactor;
+
+			for (Index k = 0; k < nLocalODE2; k++)
+			{
+				//use local jacobian:
+				localJacobian(k, i) = epsInv * (f0[k] - f1[k]); //-(f1-f0) == (f0-f1): negative sign, because object ODE2RHS is subtracted from global RHS-vector
+			}
+		}
+		return 1.;
+	}
+	return 0.;
+}
+
+//! compute local object jacobians of ODE2RHS with parallelComputationData.numberOfThreads threads;
+//! objects are processed color by color, such that objects perturbing the same coordinate are never computed at the same time;
+//! local jacobians are stored per object and added to jacobianGM serially in object order, giving the same result as the serial computation;
+//! objects with python user functions (GIL) are computed serially in the main thread
+void CSystem::NumericalJacobianODE2RHSmultithreaded(TemporaryComputationData& temp, const NumericalDifferentiationSettings& numDiff,
+	Vector& f0, Vector& f1, GeneralMatrix& jacobianGM, Real scalarFactor, bool velocityLevel)
+{
+	ParallelComputationData& pData = parallelComputationData;
+	const ResizableArray<CObject*>& objects = cSystemData.GetCObjects();
+	const ObjectContainer<ArrayIndex>& localToGlobalODE2 = cSystemData.GetLocalToGlobalODE2();
+	Index nObjects = objects.NumberOfItems();
+
+	if (!pData.objectColoringValid) { ComputeObjectColoringODE2(); }
+
+	pData.objectJacobianOffsets.SetNumberOfItems(nObjects + 1);
+	Index offset = 0;
+	for (Index j = 0; j < nObjects; j++)
+	{
+		pData.objectJacobianOffsets[j] = offset;
+		if (!AddsJacobianODE2Directly(objects[j], velocityLevel)) { offset += EXUstd::Square(localToGlobalODE2[j].NumberOfItems()); }
+	}
+	pData.objectJacobianOffsets[nObjects] = offset;
+	pData.objectJacobians.SetNumberOfItems(offset);
+	pData.objectJacobianFactors.SetNumberOfItems(nObjects);
+	pData.objectJacobianFactors.SetAll(0.);
+
+	std::exception_ptr threadException = nullptr; //exceptions must not leave the parallel region
+
+	for (Index color = 0; color + 1 < pData.colorOffsets.NumberOfItems(); color++)
+	{
+		#pragma omp parallel for num_threads((int)pData.numberOfThreads) schedule(static)
+		for (int ii = (int)pData.colorOffsets[color]; ii < (int)pData.colorOffsets[color + 1]; ii++)
+		{
+			Index j = pData.colorObjects[(Index)ii];
+			CObject* object = objects[j];
+			if (object->IsActive() && !object->HasUserFunction() && !AddsJacobianODE2Directly(object, velocityLevel))
+			{
+				TemporaryComputationData& threadTemp = *(pData.threadTempData[omp_get_thread_num()]);
+				try
+				{
+					Real factor = ComputeObjectJacobianODE2RHS<false>(threadTemp, numDiff, object, localToGlobalODE2[j],
+						threadTemp.numericalJacobianf0, threadTemp.numericalJacobianf1, scalarFactor, velocityLevel);
+					if (factor != 0.)
+					{
+						const ResizableMatrix& localJacobian = velocityLevel ? threadTemp.localJacobian_t : threadTemp.localJacobian;
+						Index jOffset = pData.objectJacobianOffsets[j];
+						Index jSize = localJacobian.NumberOfRows() * localJacobian.NumberOfColumns();
+						CHECKandTHROW(jOffset + jSize == pData.objectJacobianOffsets[j + 1], "CSystem::NumericalJacobianODE2RHSmultithreaded: object jacobian size inconsistent with coordinates");
+						const Real* localData = localJacobian.GetDataPointer();
+						for (Index k = 0; k < jSize; k++)
+						{
+							pData.objectJacobians[jOffset + k] = localData[k];
+						}
+						pData.objectJacobianFactors[j] = factor;
+					}
+				}
+				catch (...)
+				{
+					#pragma omp critical
+					{
+						if (!threadException) { threadException = std::current_exception(); }
+					}
+				}
+			}
+		}
+		if (threadException) { std::rethrow_exception(threadException); }
+	}
+
+	//add local jacobians in object order; user function objects and objects adding jacobians directly are computed here
+	for (Index j = 0; j < nObjects; j++)
+	{
+		const ArrayIndex& ltgODE2 = localToGlobalODE2[j];
+		Index nLocalODE2 = ltgODE2.NumberOfItems();
+		if (objects[j]->IsActive() && nLocalODE2 && AddsJacobianODE2Directly(objects[j], velocityLevel))
+		{
+			objects[j]->AddJacobianODE2_ODE2(jacobianGM, -scalarFactor, ltgODE2, velocityLevel);
+		}
+		else if (pData.objectJacobianFactors[j] != 0.)
+		{
+			LinkedDataMatrix localJacobian(pData.objectJacobians.GetDataPointer() + pData.objectJacobianOffsets[j], nLocalODE2, nLocalODE2);
+			jacobianGM.AddSubmatrix(localJacobian, pData.objectJacobianFactors[j], ltgODE2, ltgODE2);
+		}
+		else if (objects[j]->IsActive() && objects[j]->HasUserFunction() && nLocalODE2)
+		{
+			Real factor = ComputeObjectJacobianODE2RHS<true>(temp, numDiff, objects[j], ltgODE2, f0, f1, scalarFactor, velocityLevel);
+			if (factor != 0.) { jacobianGM.AddSubmatrix(velocityLevel ? temp.localJacobian_t : temp.localJacobian, factor, ltgODE2, ltgODE2); }
+		}
+	}
+}
+
+//! greedy coloring of objects: objects of one color do not share ODE2 coordinates and can be differentiated in parallel;
+//! objects without ODE2 coordinates are not colored
+void CSystem::ComputeObjectColoringODE2()
+{
+	ParallelComputationData& pData = parallelComputationData;
+	const ObjectContainer<ArrayIndex>& localToGlobalODE2 = cSystemData.GetLocalToGlobalODE2();
+	Index nObjects = cSystemData.GetCObjects().NumberOfItems();
+
+	ArrayIndex coordinateColor(cSystemData.GetNumberOfCoordinatesODE2()); //last color which uses coordinate
+	coordinateColor.SetNumberOfItems(cSystemData.GetNumberOfCoordinatesODE2());
+	coordinateColor.SetAll(EXUstd::InvalidIndex);
+	ArrayIndex objectColored(nObjects);
+	objectColored.SetNumberOfItems(nObjects);
+
+	Index nUncolored = 0;
+	for (Index j = 0; j < nObjects; j++)
+	{
+		objectColored[j] = (localToGlobalODE2[j].NumberOfItems() == 0);
+		if (!objectColored[j]) { nUncolored++; }
+	}
+
+	pData.colorObjects.SetNumberOfItems(0);
+	pData.colorOffsets.SetNumberOfItems(0);
+	Index color = 0;
+	while (nUncolored)
+	{
+		pData.colorOffsets.Append(pData.colorObjects.NumberOfItems());
+		for (Index j = 0; j < nObjects; j++)
+		{
+			if (!objectColored[j])
+			{
+				const ArrayIndex& ltgODE2 = localToGlobalODE2[j];
+				bool isFree = true;
+				for (Index k : ltgODE2) { if (coordinateColor[k] == color) { isFree = false; break; } }
+				if (isFree)
+				{
+					for (Index k : ltgODE2) { coordinateColor[k] = color; }
+					pData.colorObjects.Append(j);
+					objectColored[j] = 1;
+					nUncolored--;
+				}
+			}
+		}
+		color++;
+	}
+	pData.colorOffsets.Append(pData.colorObjects.NumberOfItems());
+	pData.objectColoringValid = true;
+}
+
+//! compute nonzero rows of every column of the ODE2RHS jacobian and greedy coloring of columns:
+//! coordinates of an object (except constraints, which do not contribute to ODE2RHS) or of a node couple to each other;
+//! column i gets the lowest color which is not used by a column sharing a row with i
+void CSystem::ComputeColumnColoringODE2()
+{
+	CompressedJacobianData& cData = compressedJacobianData;
+	const ObjectContainer<ArrayIndex>& localToGlobalODE2 = cSystemData.GetLocalToGlobalODE2();
+	Index nODE2 = cSystemData.GetNumberOfCoordinatesODE2();
+
+	//items (objects or nodes) coupling coordinates:
+	ObjectContainer<ArrayIndex> items;
+	ArrayIndex itemCoordinates;
+	for (Index j = 0; j < cSystemData.GetCObjects().NumberOfItems(); j++)
+	{
+		if (!((Index)cSystemData.GetCObjects()[j]->GetType() & (Index)CObjectType::Constraint) && localToGlobalODE2[j].NumberOfItems())
+		{
+			items.Append(localToGlobalODE2[j]);
+		}
+	}
+	for (CNode* node : cSystemData.GetCNodes())
+	{
+		if (node->GetNumberOfODE2Coordinates())
+		{
+			itemCoordinates.SetNumberOfItems(0);
+			for (Index i = 0; i < node->GetNumberOfODE2Coordinates(); i++) { itemCoordinates.Append(node->GetGlobalODE2CoordinateIndex() + i); }
+			items.Append(itemCoordinates);
+		}
+	}
+
+	//items of every coordinate:
+	ObjectContainer<ArrayIndex> coordinateItems;
+	itemCoordinates.SetNumberOfItems(0);
+	for (Index i = 0; i < nODE2; i++) { coordinateItems.Append(itemCoordinates); }
+	for (Index k = 0; k < items.NumberOfItems(); k++)
+	{
+		for (Index i : items[k]) { coordinateItems[i].Append(k); }
+	}
+
+	//rows of every column = union of coordinates of all items containing the column coordinate:
+	ArrayIndex lastColumn(nODE2);
+	lastColumn.SetNumberOfItems(nODE2);
+	lastColumn.SetAll(EXUstd::InvalidIndex);
+	cData.columnRows.Flush();
+	for (Index i = 0; i < nODE2; i++)
+	{
+		itemCoordinates.SetNumberOfItems(0);
+		for (Index k : coordinateItems[i])
+		{
+			for (Index row : items[k])
+			{
+				if (lastColumn[row] != i) { lastColumn[row] = i; itemCoordinates.Append(row); }
+			}
+		}
+		std::sort(itemCoordinates.begin(), itemCoordinates.end());
+		cData.columnRows.Append(itemCoordinates);
+	}
+
+	//greedy coloring; structure is symmetric, therefore columns sharing a row with column i are columnRows[row] for all rows of i
+	ArrayIndex columnColor(nODE2);
+	columnColor.SetNumberOfItems(nODE2);
+	columnColor.SetAll(EXUstd::InvalidIndex);
+	ArrayIndex colorUsedBy; //last column, for which color has been marked as forbidden
+	Index nColors = 0;
+	for (Index i = 0; i < nODE2; i++)
+	{
+		for (Index row : cData.columnRows[i])
+		{
+			for (Index k : cData.columnRows[row])
+			{
+				if (columnColor[k] != EXUstd::InvalidIndex) { colorUsedBy[columnColor[k]] = i; }
+			}
+		}
+		Index color = 0;
+		while (color < nColors && colorUsedBy[color] == i) { color++; }
+		if (color == nColors) { colorUsedBy.Append(EXUstd::InvalidIndex); nColors++; }
+		columnColor[i] = color;
+	}
+
+	//sort columns by color:
+	cData.colorOffsets.SetNumberOfItems(nColors + 1);
+	cData.colorOffsets.SetAll(0);
+	for (Index i = 0; i < nODE2; i++) { cData.colorOffsets[columnColor[i] + 1]++; }
+	for (Index c = 0; c < nColors; c++) { cData.colorOffsets[c + 1] += cData.colorOffsets[c]; }
+	cData.colorColumns.SetNumberOfItems(nODE2);
+	lastColumn.SetNumberOfItems(nColors); //used as insert position per color
+	for (Index c = 0; c < nColors; c++) { lastColumn[c] = cData.colorOffsets[c]; }
+	for (Index i = 0; i < nODE2; i++) { cData.colorColumns[lastColumn[columnColor[i]]++] = i; }
+
+	cData.coloringValid = true;
+}
+
+//! system-wide numerical differentiation with one ODE2RHS evaluation per color; as the columns of one color have no common rows,
+//! the difference f1-f0 contains the columns of all perturbed coordinates in disjoint rows; entries are added column-wise in fixed order,
+//! such that the sparsity pattern is the same in every call
+void CSystem::NumericalJacobianODE2RHScompressed(TemporaryComputationData& temp, const NumericalDifferentiationSettings& numDiff,
+	Vector& f0, Vector& f1, GeneralMatrix& jacobianGM, Real scalarFactor, bool velocityLevel)
+{
+	CompressedJacobianData& cData = compressedJacobianData;
+	if (!cData.coloringValid) { ComputeColumnColoringODE2(); }
+
+	Index nODE2 = cSystemData.GetNumberOfCoordinatesODE2();
+	Vector& x = velocityLevel ? cSystemData.GetCData().currentState.ODE2Coords_t : cSystemData.GetCData().currentState.ODE2Coords;
+	const Vector& xRef = cSystemData.GetCData().referenceState.ODE2Coords;
+	bool addReference = numDiff.addReferenceCoordinatesToEpsilon && !velocityLevel;
+
+	f0.SetNumberOfItems(nODE2);
+	f1.SetNumberOfItems(nODE2);
+	ComputeODE2RHS(temp, f0); //compute nominal value for jacobian
+
+	cData.columnIndex.SetNumberOfItems(1);
+	for (Index c = 0; c < cData.NumberOfColors(); c++)
+	{
+		Index start = cData.colorOffsets[c];
+		Index nColumns = cData.colorOffsets[c + 1] - start;
+		cData.columnEpsilon.SetNumberOfItems(nColumns);
+		cData.columnStore.SetNumberOfItems(nColumns);
+		for (Index k = 0; k < nColumns; k++)
+		{
+			Index i = cData.colorColumns[start + k];
+			Real xRefVal = addReference ? xRef[i] : 0.;
+			cData.columnEpsilon[k] = numDiff.relativeEpsilon * (EXUstd::Maximum(numDiff.minimumCoordinateSize, fabs(x[i] + xRefVal)));
+			cData.columnStore[k] = x[i];
+			x[i] += cData.columnEpsilon[k];
+		}
+		ComputeODE2RHS(temp, f1);
+		for (Index k = 0; k < nColumns; k++) { x[cData.colorColumns[start + k]] = cData.columnStore[k]; }
+
+		f1 -= f0;
+		for (Index k = 0; k < nColumns; k++)
+		{
+			Index i = cData.colorColumns[start + k];
+			const ArrayIndex& rows = cData.columnRows[i];
+			cData.columnValues.SetNumberOfRowsAndColumns(rows.NumberOfItems(), 1);
+			for (Index r = 0; r < rows.NumberOfItems(); r++) { cData.columnValues(r, 0) = f1[rows[r]]; }
+			cData.columnIndex[0] = i;
+			jacobianGM.AddSubmatrix(cData.columnValues, scalarFactor / cData.columnEpsilon[k], rows, cData.columnIndex);
+		}
+	}
+}
+
 //! numerical computation of constraint jacobian with respect to ODE2 and ODE1 (fillIntoSystemMatrix=true: also w.r.t. AE) coordinates
 //! factorODE2 is used to scale the ODE2-part of the jacobian (to avoid postmultiplication); 
 //! velocityLevel = velocityLevel constraints are used, if available; 
@@ -29,6 +29,14 @@
 
 class MainSystem;
 class System;
+class CObjectConnectorSpringDamper;
+
+//! selection of bodies in mass matrix computation; used by solvers to cache the constant part of the mass matrix
+enum class MassMatrixBodies {
+	All = 0,				//!< all bodies
+	Constant = 1,			//!< only bodies with HasConstantMassMatrix() == true
+	StateDependent = 2		//!< only bodies with coordinate- or time-dependent mass matrix
+};
 
 //! @brief class for temporary data during computation (time integration, static solver, etc.)
 //! use multiple instances for parallelization
@@ -58,6 +66,113 @@ public:
 	MarkerDataStructure markerDataStructure;
 };
 
+//! @brief class for multithreaded computation of system quantities (ODE2 RHS, jacobians)
+//! - contains one TemporaryComputationData per thread and per-object result buffers
+//! - per-object results are computed in parallel and added to system vectors serially in object order;
+//!   therefore, results are identical to serial computation, independently of the number of threads
+class ParallelComputationData
+{
+public:
+	Index numberOfThreads;									//!< number of threads used for system computation; 1 = serial computation
+	ResizableArray<TemporaryComputationData*> threadTempData;	//!< one TemporaryComputationData per thread
+	ArrayIndex objectODE2RHSoffsets;						//!< start index of every object in objectODE2RHS; size = numberOfObjects+1
+	ArrayIndex objectODE2RHSsize;							//!< per object: size of RHS computed in parallel; 0, if not computed (inactive, user function, ...)
+	ResizableVector objectODE2RHS;							//!< per-object ODE2 RHS, filled in parallel threads
+
+	bool objectColoringValid;								//!< false, if coloring needs to be recomputed (e.g. after Assemble())
+	ArrayIndex colorObjects;								//!< object indices sorted by colors; objects of the same color do not share ODE2 coordinates
+	ArrayIndex colorOffsets;								//!< start index of every color in colorObjects; size = numberOfColors+1
+	ArrayIndex objectJacobianOffsets;						//!< start index of every object in objectJacobians
+	ResizableVector objectJacobians;						//!< per-object local jacobians, filled in parallel threads
+	ResizableVector objectJacobianFactors;					//!< per object: factor to add local jacobian to system jacobian; 0, if not computed in parallel
+
+	ParallelComputationData() { numberOfThreads = 1; objectColoringValid = false; }
+	ParallelComputationData(const ParallelComputationData&) = delete;
+	ParallelComputationData& operator=(const ParallelComputationData&) = delete;
+	~ParallelComputationData() { SetNumberOfThreads(0); }
+
+	//! set number of threads and (de-)allocate according thread-local data; numberOfThreads=0 only used for deletion
+	void SetNumberOfThreads(Index numberOfThreadsInit)
+	{
+		for (TemporaryComputationData* item : threadTempData) { delete item; }
+		threadTempData.SetNumberOfItems(0);
+
+		numberOfThreads = numberOfThreadsInit;
+		if (numberOfThreads > 1)
+		{
+			for (Index i = 0; i < numberOfThreads; i++) { threadTempData.Append(new TemporaryComputationData()); }
+		}
+	}
+
+	//! true, if computation shall be done multithreaded
+	bool UseMultithreading() const { return numberOfThreads > 1; }
+};
+
+//! @brief column coloring for compressed (Curtis-Powell-Reed) system-wide numerical differentiation of ODE2RHS
+//! - structure of jacobian follows from ODE2 coordinates of objects (not constraints) and nodes: coordinates of one item couple to each other
+//! - columns of the same color have no common nonzero row; they are perturbed at once in one ODE2RHS evaluation
+class CompressedJacobianData
+{
+public:
+	bool coloringValid;						//!< false, if coloring needs to be recomputed (e.g. after Assemble())
+	ObjectContainer<ArrayIndex> columnRows;	//!< per ODE2 coordinate (column): sorted rows of structurally nonzero entries
+	ArrayIndex colorColumns;				//!< column indices sorted by colors
+	ArrayIndex colorOffsets;				//!< start index of every color in colorColumns; size = numberOfColors+1
+	ResizableVector columnEpsilon;			//!< temporary: differentiation parameter per column of current color
+	ResizableVector columnStore;			//!< temporary: unperturbed coordinates of current color
+	ResizableMatrix columnValues;			//!< temporary: nonzero entries of one column
+	ArrayIndex columnIndex;					//!< temporary: column index for AddSubmatrix
+
+	CompressedJacobianData() { coloringValid = false; }
+
+	//! number of ODE2RHS evaluations per jacobian (excluding nominal value)
+	Index NumberOfColors() const { return colorOffsets.NumberOfItems() ? colorOffsets.NumberOfItems() - 1 : 0; }
+};
+
+//! @brief structure-of-arrays data for batched computation of homogeneous object populations in ComputeODE2RHS:
+//! - ObjectConnectorSpringDamper between point nodes, mass points or ground (MarkerNodePosition or MarkerBodyPosition); 
+//!   forces are computed for all spring-dampers in contiguous loops, without marker data and marker jacobians (which are unit matrices)
+//! - MassPoint and MassPoint2D have zero ODE2RHS and are skipped
+//! - batched results are added to ode2Rhs in object order; therefore, results are identical to per-object computation
+class BatchedObjectData
+{
+public:
+	static const Index zeroODE2RHS = EXUstd::InvalidIndex - 1;	//!< objectBatchIndex of objects with zero ODE2RHS
+
+	bool useBatchedComputation;				//!< set by solver (simulationSettings.batchedObjectComputation); false: all objects are computed per object
+	ArrayIndex objectBatchIndex;			//!< per object: index in spring-damper arrays, zeroODE2RHS or EXUstd::InvalidIndex (computed per object)
+
+	ResizableArray<const CObjectConnectorSpringDamper*> springDampers; //!< parameters are read in every evaluation, as they may be changed by SetObjectParameter
+	ArrayIndex markerCoordinate[2];			//!< per spring-damper and marker: global index of first ODE2 coordinate of node; EXUstd::InvalidIndex for ground
+	ArrayIndex markerDimension[2];			//!< per spring-damper and marker: number of node coordinates (2 or 3); 0 for ground
+	ResizableArray<const Real*> markerReference[2];		//!< per spring-damper and marker: node reference coordinates or ground reference position
+	ResizableArray<const Real*> markerLocalPosition[2];	//!< per spring-damper and marker: local position of MarkerBodyPosition; nullptr for MarkerNodePosition
+
+	ResizableVector relPos[3];				//!< temporary: components of relative position of markers per spring-damper
+	ResizableVector relVel[3];				//!< temporary: components of relative velocity of markers per spring-damper
+	ResizableVector stiffness;				//!< temporary: stiffness per spring-damper; set to zero for inactive connectors
+	ResizableVector damping;				//!< temporary: damping per spring-damper; set to zero for inactive connectors
+	ResizableVector referenceLength;		//!< temporary: reference length per spring-damper
+	ResizableVector springForce;			//!< temporary: constant force per spring-damper; set to zero for inactive connectors
+	ResizableVector force[3];				//!< components of force vector acting on marker 1 per spring-damper
+
+	BatchedObjectData() { useBatchedComputation = true; }
+
+	//! reset object lists, e.g. in Assemble()
+	void Reset()
+	{
+		objectBatchIndex.SetNumberOfItems(0);
+		springDampers.SetNumberOfItems(0);
+		for (Index i = 0; i < 2; i++)
+		{
+			markerCoordinate[i].SetNumberOfItems(0);
+			markerDimension[i].SetNumberOfItems(0);
+			markerReference[i].SetNumberOfItems(0);
+			markerLocalPosition[i].SetNumberOfItems(0);
+		}
+	}
+};
+
 class VisualizationSystem; //for backlink to VisualizationSystem for PythonUserFunctions for drawing
 
 //! @brief class that contains relevant data for postprocessing:
@@ -127,6 +242,7 @@ class SolverData
 public:
 	Real loadFactor;			//!< load factor, mainly used for static computation; should be set to 1, otherwise all loads are reduced by this factor
 	bool signalJacobianUpdate;  //!< false: default, do nothing; true: jacobian (of static computation or time integration) shall be updated, e.g. due to system change - if constraints are turned off, ...; this flag is regularly reset within a jacobian computation
+	bool signalMassMatrixUpdate;//!< false: default, do nothing; true: mass matrix cached by solver (reuseConstantMassMatrix) is invalid, e.g. because object parameters have been changed; reset by solver after recomputation of mass matrix
 
 	SolverData()
 	{
@@ -138,6 +254,7 @@ public:
 	{
 		loadFactor = 1;
 		signalJacobianUpdate = false;
+		signalMassMatrixUpdate = false;
 	}
 };
 
@@ -172,6 +289,9 @@ protected:
 	PostProcessData postProcessData;	//!< data needed for post-processing
 	SolverData solverData;				//!< data updated by specific solvers 
 	PythonUserFunctions pythonUserFunctions; //!< user functions and MainSystem
+	ParallelComputationData parallelComputationData; //!< thread-local data for multithreaded computation
+	CompressedJacobianData compressedJacobianData;	//!< coloring for compressed system-wide numerical differentiation
+	BatchedObjectData batchedObjectData;			//!< structure-of-arrays data for batched computation of ODE2RHS
 
 	bool systemIsConsistent;				//!< variable is set after check of system consistency ==> in order to draw or compute system; usually set after Assemble()
 
@@ -198,6 +318,12 @@ public:
 
 	SolverData& GetSolverData() { return solverData; }
 	const SolverData& GetSolverData() const { return solverData; }
+
+	ParallelComputationData& GetParallelComputationData() { return parallelComputationData; }
+	const ParallelComputationData& GetParallelComputationData() const { return parallelComputationData; }
+
+	BatchedObjectData& GetBatchedObjectData() { return batchedObjectData; }
+	const BatchedObjectData& GetBatchedObjectData() const { return batchedObjectData; }
 	// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 	// CSystem management functions
 	// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -252,6 +378,9 @@ public:
 	//! build ltg-coordinate lists for objects (used to build global ODE2RHS, MassMatrix, etc. vectors and matrices)
 	void AssembleLTGLists(const MainSystem& mainSystem);
 
+	//! build lists of objects for batched computation of ODE2RHS (see BatchedObjectData); called after ltg lists are built
+	void AssembleBatchedObjectData(const MainSystem& mainSystem);
+
 	////! NEEDED? prepare LinkedDataVectors for objects
 	//void AssembleObjects();
 
@@ -262,15 +391,49 @@ public:
     // CSystem computation functions
     // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
     //! compute system massmatrix and ADD to given massMatrix; matrix needs to have according size; set entries to zero beforehand, if only the mass matrix is required
-	virtual void ComputeMassMatrix(TemporaryComputationData& temp, GeneralMatrix& massMatrix);
+	//! bodies selects all bodies or only bodies with constant / state-dependent mass matrix
+	virtual void ComputeMassMatrix(TemporaryComputationData& temp, GeneralMatrix& massMatrix, MassMatrixBodies bodies = MassMatrixBodies::All);
+
+	//! compute product of system mass matrix with vector x body by body and ADD to result, without assembling the mass matrix; bodies as in ComputeMassMatrix
+	virtual void ComputeMassMatrixTimesVector(TemporaryComputationData& temp, const Vector& x, Vector& result, MassMatrixBodies bodies = MassMatrixBodies::All);
 	//virtual void ComputeMassMatrixOLD(TemporaryComputationData& temp, Matrix& massMatrix);
 
+	//! return true, if all bodies have constant mass matrices (independent of coordinates and time)
+	virtual bool HasConstantMassMatrix() const;
+
 	//! compute right-hand-side (RHS) of second order ordinary differential equations (ODE) for every object (used in numerical differentiation and in RHS computation); return true, if object has localODE2Rhs, false otherwise
 	virtual bool ComputeObjectODE2RHS(TemporaryComputationData& temp, CObject* object, Vector& localODE2Rhs);
-		
+
+	//! same as ComputeObjectODE2RHS; useGlobalTimers=false for calls from parallel threads, as global timers are not thread-safe
+	template<bool useGlobalTimers>
+	bool ComputeObjectODE2RHStemplate(TemporaryComputationData& temp, CObject* object, Vector& localODE2Rhs);
+
 	//! compute right-hand-side (RHS) of second order ordinary differential equations (ODE) to 'ode2rhs' for ODE2 part
 	virtual void ComputeODE2RHS(TemporaryComputationData& temp, Vector& ode2Rhs);
 
+	//! compute object ODE2RHS multithreaded and add to 'ode2Rhs' in object order (deterministic); objects with python user functions are computed serially
+	virtual void ComputeODE2RHSmultithreaded(TemporaryComputationData& temp, Vector& ode2Rhs);
+
+	//! true, if batched computation is used in ComputeODE2RHS; requires batchedObjectData to be consistent with objects
+	bool UseBatchedComputation() const
+	{
+		return batchedObjectData.useBatchedComputation && batchedObjectData.objectBatchIndex.NumberOfItems() == cSystemData.GetCObjects().NumberOfItems();
+	}
+
+	//! compute forces of all batched spring-dampers into batchedObjectData.force
+	void ComputeBatchedSpringDamperForces();
+
+	//! add ODE2RHS of batched spring-damper with index batchIndex to 'ode2Rhs'
+	void AddBatchedSpringDamperODE2RHS(Index batchIndex, const ArrayIndex& ltgODE2, Vector& ode2Rhs) const
+	{
+		const BatchedObjectData& bData = batchedObjectData;
+		Index n0 = bData.markerDimension[0][batchIndex];
+		Index n1 = bData.markerDimension[1][batchIndex];
+		//negative sign ==> stiffness/damping on LHS of equations; force acts negative on marker 0
+		for (Index k = 0; k < n0; k++) { ode2Rhs[ltgODE2[k]] += bData.force[k][batchIndex]; }
+		for (Index k = 0; k < n1; k++) { ode2Rhs[ltgODE2[n0 + k]] -= bData.force[k][batchIndex]; }
+	}
+
 	//! compute right-hand-side (RHS) due to loads and add them to 'ode2rhs' for ODE2 part
 	virtual void ComputeLoads(TemporaryComputationData& temp, Vector& ode2Rhs);
 
@@ -316,6 +479,28 @@ public:
 	void NumericalJacobianODE2RHS_t(TemporaryComputationData& temp, const NumericalDifferentiationSettings& numDiff,
 		Vector& f0, Vector& f1, GeneralMatrix& jacobianGM, Real scalarFactor = 1.);
 
+	//! compute local jacobian of object ODE2RHS w.r.t. ODE2 coordinates into temp.localJacobian (velocityLevel=false) or w.r.t. ODE2_t coordinates into temp.localJacobian_t (velocityLevel=true);
+	//! f0 and f1 are temporary vectors; returns the factor to add the local jacobian to the system jacobian or 0, if object has no ODE2 jacobian
+	template<bool useGlobalTimers>
+	Real ComputeObjectJacobianODE2RHS(TemporaryComputationData& temp, const NumericalDifferentiationSettings& numDiff, CObject* object,
+		const ArrayIndex& ltgODE2, Vector& f0, Vector& f1, Real scalarFactor, bool velocityLevel);
+
+	//! compute local object jacobians of ODE2RHS multithreaded and add them to jacobianGM in object order (deterministic);
+	//! objects with common coordinates are computed in different colors, as coordinates are perturbed in the system state
+	void NumericalJacobianODE2RHSmultithreaded(TemporaryComputationData& temp, const NumericalDifferentiationSettings& numDiff,
+		Vector& f0, Vector& f1, GeneralMatrix& jacobianGM, Real scalarFactor, bool velocityLevel);
+
+	//! compute coloring of objects such that objects of one color do not share ODE2 coordinates; stored in parallelComputationData
+	void ComputeObjectColoringODE2();
+
+	//! compute system-wide jacobian of ODE2RHS w.r.t. ODE2 coordinates (velocityLevel=false) or ODE2_t coordinates (velocityLevel=true)
+	//! by perturbing all columns of one color at once; the entries are ADDed to jacobianGM, multiplied with scalarFactor
+	void NumericalJacobianODE2RHScompressed(TemporaryComputationData& temp, const NumericalDifferentiationSettings& numDiff,
+		Vector& f0, Vector& f1, GeneralMatrix& jacobianGM, Real scalarFactor, bool velocityLevel);
+
+	//! compute sparsity structure and greedy column coloring of ODE2RHS jacobian; stored in compressedJacobianData
+	void ComputeColumnColoringODE2();
+
 	//! numerical computation of constraint jacobian with respect to ODE2 and ODE1 (fillIntoSystemMatrix=true: also w.r.t. AE) coordinates
 	//! the jacobian is ADDed to the given matrix, which needs to have according size; set entries to zero beforehand in order to obtain only the jacobian
 	//! factorODE2 is used to scale the ODE2-part of the jacobian (to avoid postmultiplication); 
@@ -575,6 +575,7 @@ void MainSystem::PySetObjectParameter(const py::object& itemIndex, const STDstri
 	if (itemNumber < mainSystemData.GetMainObjects().NumberOfItems())
 	{
 		mainSystemData.GetMainObjects().GetItem(itemNumber)->SetParameter(parameterName, value);
+		GetCSystem()->GetSolverData().signalMassMatrixUpdate = true; //parameter may change mass matrix cached by solver
 	}
 	else
 	{
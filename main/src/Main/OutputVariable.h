@@ -393,7 +393,12 @@ inline AccessFunctionType GetAccessFunctionType(LoadType loadType, Marker::Type
 enum class LinearSolverType {
 	_None = 0,			//marks that no type is used
 	EXUdense = 1,		//use internal dense matrix (e.g. matrix inverse for factorization)
-	EigenSparse = 2		//use Eigen::SparseMatrix
+	EigenSparse = 2,			//use Eigen::SparseMatrix with Eigen::SparseLU (supernodal LU with COLAMD ordering)
+	EigenSparseSymmetric = 3,	//use Eigen::SparseMatrix with Eigen::SparseLU in symmetric mode (diagonal pivots preferred; symmetric or saddle point matrices)
+	EigenSparseLUAMD = 4,		//use Eigen::SparseMatrix with Eigen::SparseLU and approximate minimum degree ordering; needs USE_EIGEN_LGPL_SOLVERS
+	EigenSparseLDLT = 5,		//use Eigen::SparseMatrix with Eigen::SimplicialLDLT (symmetric matrices, no pivoting); needs USE_EIGEN_LGPL_SOLVERS
+	EigenSparseLLT = 6,			//use Eigen::SparseMatrix with Eigen::SimplicialLLT (symmetric positive definite matrices); needs USE_EIGEN_LGPL_SOLVERS
+	EigenSparseIterative = 7	//use Eigen::SparseMatrix with iterative Eigen::BiCGSTAB solver and incomplete LU (ILUT) preconditioner; preconditioner only recomputed at Jacobian updates
 };
 
 //! ostream operator for printing of enum class
@@ -404,6 +409,11 @@ inline std::ostream& operator<<(std::ostream& os, LinearSolverType value)
 	case LinearSolverType::_None:			return os << "_None"; break;
 	case LinearSolverType::EXUdense:			return os << "EXUdense"; break;
 	case LinearSolverType::EigenSparse:		return os << "EigenSparse"; break;
+	case LinearSolverType::EigenSparseSymmetric:	return os << "EigenSparseSymmetric"; break;
+	case LinearSolverType::EigenSparseLUAMD:	return os << "EigenSparseLUAMD"; break;
+	case LinearSolverType::EigenSparseLDLT:	return os << "EigenSparseLDLT"; break;
+	case LinearSolverType::EigenSparseLLT:	return os << "EigenSparseLLT"; break;
+	case LinearSolverType::EigenSparseIterative:	return os << "EigenSparseIterative"; break;
 	default: 		return os << "LinearSolverType::invalid";
 	}
 }
@@ -20,10 +20,7 @@
 #include "Pymodules/PybindUtilities.h"
 #include "Autogenerated/MainObjectANCFCable2D.h"
 
-#include<ostream> //for autodiff
-#include "../ngs-core-master/autodiff.hpp"
-
-typedef ngstd::AutoDiff<16, Real> DReal16;
+#include "Linalg/AutoDiffJacobian.h"
 
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 //ANCFCable2D BASE class
@@ -472,34 +469,17 @@ void CObjectANCFCable2DBase::ComputeODE2RHStemplate(VectorBase<TReal>& ode2Rhs,
 }
 
 
+//! exact jacobian of ComputeODE2RHStemplate(...) by forward mode automatic differentiation w.r.t. 8 coordinates and 8 velocities
 void CObjectANCFCable2DBase::ComputeJacobianODE2_ODE2(ResizableMatrix& jacobian, ResizableMatrix& jacobian_ODE2_t) const
 {
-	const Index ns = 4;   //number of shape functions
-	ConstSizeVector<2*ns> qANCF0;
-	ConstSizeVector<2*ns> qANCF0_t;
-	ConstSizeVectorBase<DReal16, 2*ns> qANCF;
-	ConstSizeVectorBase<DReal16, 2*ns> qANCF_t;
+	ConstSizeVector<nODE2Coordinates> qANCF0;
+	ConstSizeVector<nODE2Coordinates> qANCF0_t;
 	ComputeCurrentObjectCoordinates(qANCF0);
 	ComputeCurrentObjectVelocities(qANCF0_t);
-	for (Index i = 0; i < 2 * ns; i++)
-	{
-		qANCF[i] = qANCF0[i];
-		qANCF_t[i] = qANCF0_t[i];
-		qANCF[i].DValue((int)i) = 1; //mark that this is the corresponding derivative
-		qANCF_t[i].DValue((int)(i+2*ns)) = 1; //mark that this is the corresponding derivative; velocity derivatives are in second block
-	}
-	ConstSizeVectorBase<DReal16, 2 * ns> ode2RHS;
 
-	ComputeODE2RHStemplate<DReal16>(ode2RHS, qANCF, qANCF_t);
-	//now copy autodifferentiated result:
-	for (Index i = 0; i < 2 * ns; i++)
-	{
-		for (Index j = 0; j < 2 * ns; j++)
-		{
-			jacobian(i, j) = ode2RHS[i].DValue((int)j);
-			jacobian_ODE2_t(i, j) = ode2RHS[i].DValue((int)(j+2*ns));
-		}
-	}
+	EXUmath::AutoDiffJacobian<nODE2Coordinates, nODE2Coordinates>(qANCF0, qANCF0_t,
+		[this](auto& ode2Rhs, const auto& qANCF, const auto& qANCF_t) { ComputeODE2RHStemplate(ode2Rhs, qANCF, qANCF_t); },
+		jacobian, jacobian_ODE2_t);
 }
 
 
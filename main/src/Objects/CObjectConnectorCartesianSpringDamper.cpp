@@ -92,9 +92,30 @@ void CObjectConnectorCartesianSpringDamper::ComputeODE2RHS(Vector& ode2Rhs, cons
 
 }
 
+//! analytic jacobians for constant marker jacobians; force components stiffness[i]*vPos[i] + damping[i]*vVel[i] are linear in coordinates and velocities
 void CObjectConnectorCartesianSpringDamper::ComputeJacobianODE2_ODE2(ResizableMatrix& jacobian, ResizableMatrix& jacobian_ODE2_t, const MarkerDataStructure& markerData) const
 {
-	CHECKandTHROWstring("ERROR: illegal call to CObjectConnectorCartesianSpringDamper::ComputeODE2RHSJacobian");
+	Real activeFactor = parameters.activeConnector ? 1. : 0.;
+	Matrix3D stiffnessMatrix(3, 3, 0.);
+	Matrix3D dampingMatrix(3, 3, 0.);
+	for (Index i = 0; i < 3; i++)
+	{
+		stiffnessMatrix(i, i) = activeFactor * parameters.stiffness[i];
+		dampingMatrix(i, i) = activeFactor * parameters.damping[i];
+	}
+
+	ComputeJacobianFromMarkerJacobians(markerData.GetMarkerData(0).positionJacobian, markerData.GetMarkerData(1).positionJacobian, stiffnessMatrix, jacobian);
+	ComputeJacobianFromMarkerJacobians(markerData.GetMarkerData(0).positionJacobian, markerData.GetMarkerData(1).positionJacobian, dampingMatrix, jacobian_ODE2_t);
+}
+
+//! analytic jacobians are only available without user function and if marker position jacobians are constant
+JacobianType::Type CObjectConnectorCartesianSpringDamper::GetAvailableJacobians() const
+{
+	if (!parameters.springForceUserFunction && HasConstantMarkerJacobians(Marker::Position))
+	{
+		return (JacobianType::Type)(JacobianType::ODE2_ODE2 + JacobianType::ODE2_ODE2_t + JacobianType::ODE2_ODE2_function + JacobianType::ODE2_ODE2_t_function);
+	}
+	return JacobianType::_None;
 }
 
 //! provide according output variable in "value"
@@ -14,6 +14,31 @@
 #include "Utilities/ExceptionsTemplates.h"
 #include "Main/CSystemData.h"
 #include "Autogenerated/CObjectConnectorCoordinateSpringDamper.h"
+#include "Linalg/AutoDiffJacobian.h"
+
+//! spring-damper force law with dry friction (without user function); templated for automatic differentiation of jacobians
+template<class TReal>
+TReal ComputeConnectorCoordinateSpringDamperForce(const CObjectConnectorCoordinateSpringDamperParameters& parameters, const TReal& relPos, const TReal& relVel)
+{
+	TReal force = parameters.stiffness * (relPos - parameters.offset) + parameters.damping * relVel;
+	if (parameters.dryFriction != 0.)
+	{
+		if (fabs(relVel) < parameters.dryFrictionProportionalZone)
+		{
+			//as long as vVel < dryFrictionProportionalZone, friction force shall linearly increase
+			force += relVel / parameters.dryFrictionProportionalZone * parameters.dryFriction;
+		}
+		else if (relVel > 0.) //sign function; derivative is zero
+		{
+			force += parameters.dryFriction; //this should be put into the nonlinear iteration for better Newton convergence ...
+		}
+		else if (relVel < 0.)
+		{
+			force -= parameters.dryFriction;
+		}
+	}
+	return force;
+}
 
 //! function provides the force, relative displacement and relative velocity of the connector
 void ComputeConnectorCoordinateSpringDamperProperties(const MarkerDataStructure& markerData, const CObjectConnectorCoordinateSpringDamperParameters& parameters,
@@ -31,19 +56,7 @@ void ComputeConnectorCoordinateSpringDamperProperties(const MarkerDataStructure&
 		if (!parameters.springForceUserFunction)
 		{
 			//compute resulting force vector:
-			force = parameters.stiffness * (relPos - parameters.offset) + parameters.damping * relVel;
-			if (parameters.dryFriction != 0.)
-			{
-				if (fabs(relVel) < parameters.dryFrictionProportionalZone)
-				{
-					//as long as vVel < dryFrictionProportionalZone, friction force shall linearly increase
-					force += relVel / parameters.dryFrictionProportionalZone * parameters.dryFriction;
-				}
-				else
-				{
-					force += parameters.dryFriction*EXUstd::Sgn(relVel); //this should be put into the nonlinear iteration for better Newton convergence ...
-				}
-			}
+			force = ComputeConnectorCoordinateSpringDamperForce(parameters, relPos, relVel);
 		}
 		else
 		{
@@ -100,9 +113,36 @@ void CObjectConnectorCoordinateSpringDamper::ComputeODE2RHS(Vector& ode2Rhs, con
 
 }
 
+//! jacobians for constant marker jacobians; derivatives of force law w.r.t. relative position and velocity by automatic differentiation
 void CObjectConnectorCoordinateSpringDamper::ComputeJacobianODE2_ODE2(ResizableMatrix& jacobian, ResizableMatrix& jacobian_ODE2_t, const MarkerDataStructure& markerData) const
 {
-	CHECKandTHROWstring("ERROR: illegal call to CObjectConnectorCoordinateSpringDamper::ComputeODE2RHSJacobian");
+	const ResizableMatrix& jacobian0 = markerData.GetMarkerData(0).jacobian;
+	const ResizableMatrix& jacobian1 = markerData.GetMarkerData(1).jacobian;
+
+	ConstSizeMatrix<1> forceDerivative(1, 1, 0.);
+	ConstSizeMatrix<1> forceDerivative_t(1, 1, 0.);
+	if (parameters.activeConnector)
+	{
+		Real relPos = markerData.GetMarkerData(1).vectorValue[0] - markerData.GetMarkerData(0).vectorValue[0];
+		Real relVel = markerData.GetMarkerData(1).vectorValue_t[0] - markerData.GetMarkerData(0).vectorValue_t[0];
+
+		EXUmath::AutoDiffJacobian<1, 1>(ConstSizeVector<1>({ relPos }), ConstSizeVector<1>({ relVel }),
+			[this](auto& force, const auto& u, const auto& v) { force[0] = ComputeConnectorCoordinateSpringDamperForce(parameters, u[0], v[0]); },
+			forceDerivative, forceDerivative_t);
+	}
+
+	ComputeJacobianFromMarkerJacobians(jacobian0, jacobian1, forceDerivative, jacobian);
+	ComputeJacobianFromMarkerJacobians(jacobian0, jacobian1, forceDerivative_t, jacobian_ODE2_t);
+}
+
+//! jacobians are only available without user function and if marker jacobians are constant
+JacobianType::Type CObjectConnectorCoordinateSpringDamper::GetAvailableJacobians() const
+{
+	if (!parameters.springForceUserFunction && HasConstantMarkerJacobians(Marker::Coordinate))
+	{
+		return (JacobianType::Type)(JacobianType::ODE2_ODE2 + JacobianType::ODE2_ODE2_t + JacobianType::ODE2_ODE2_function + JacobianType::ODE2_ODE2_t_function);
+	}
+	return JacobianType::_None;
 }
 
 ////! Flags to determine, which output variables are available (displacment, velocity, stress, ...)
@@ -123,9 +163,9 @@ void CObjectConnectorCoordinateSpringDamper::GetOutputVariableConnector(OutputVa
 
 	switch (variableType)
 	{
-	case OutputVariableType::Displacement: value = Vector({ relPos }); break;
-	case OutputVariableType::Velocity: value = Vector({ relVel }); break;
-	case OutputVariableType::Force: value = Vector({ force }); break;
+	case OutputVariableType::Displacement: value.SetVector({ relPos }); break;
+	case OutputVariableType::Velocity: value.SetVector({ relVel }); break;
+	case OutputVariableType::Force: value.SetVector({ force }); break;
 	default:
 		SysError("CObjectConnectorCoordinateSpringDamper::GetOutputVariable failed"); //error should not occur, because types are checked!
 	}
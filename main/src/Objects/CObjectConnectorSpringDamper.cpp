@@ -97,9 +97,53 @@ void CObjectConnectorSpringDamper::ComputeODE2RHS(Vector& ode2Rhs, const MarkerD
 	}
 }
 
+//! analytic jacobians for constant marker jacobians; with n = relPos/L, fVec = force*n:
+//! d(fVec)/d(relPos) = stiffness*n*n^T + damping*n*relVel^T*(I-n*n^T)/L + force*(I-n*n^T)/L and d(fVec)/d(relVel) = damping*n*n^T
 void CObjectConnectorSpringDamper::ComputeJacobianODE2_ODE2(ResizableMatrix& jacobian, ResizableMatrix& jacobian_ODE2_t, const MarkerDataStructure& markerData) const
 {
-	CHECKandTHROWstring("ERROR: illegal call to CObjectConnectorSpringDamper::ComputeODE2RHSJacobian");
+	Matrix3D stiffnessMatrix(3, 3, 0.);
+	Matrix3D dampingMatrix(3, 3, 0.);
+
+	if (parameters.activeConnector)
+	{
+		Real force;
+		Vector3D relPos, relVel, forceDirection;
+		ComputeConnectorProperties(markerData, parameters, relPos, relVel, force, forceDirection);
+		Real springLengthInv = 1. / relPos.GetL2Norm(); //springLength = 0 already checked in ComputeConnectorProperties
+
+		for (Index i = 0; i < 3; i++)
+		{
+			for (Index j = 0; j < 3; j++)
+			{
+				Real nn = forceDirection[i] * forceDirection[j];
+				Real projector = ((i == j) ? 1. : 0.) - nn; //(I - n*n^T)
+				dampingMatrix(i, j) = parameters.damping * nn;
+				stiffnessMatrix(i, j) = parameters.stiffness * nn + force * springLengthInv * projector;
+			}
+		}
+		//damping term: d/d(relPos) of (relVel*n) = relVel^T*(I-n*n^T)/L
+		Vector3D relVelProjected = springLengthInv * (relVel - (relVel*forceDirection)*forceDirection);
+		for (Index i = 0; i < 3; i++)
+		{
+			for (Index j = 0; j < 3; j++)
+			{
+				stiffnessMatrix(i, j) += parameters.damping * forceDirection[i] * relVelProjected[j];
+			}
+		}
+	}
+
+	ComputeJacobianFromMarkerJacobians(markerData.GetMarkerData(0).positionJacobian, markerData.GetMarkerData(1).positionJacobian, stiffnessMatrix, jacobian);
+	ComputeJacobianFromMarkerJacobians(markerData.GetMarkerData(0).positionJacobian, markerData.GetMarkerData(1).positionJacobian, dampingMatrix, jacobian_ODE2_t);
+}
+
+//! analytic jacobians are only available without user function and if marker position jacobians are constant
+JacobianType::Type CObjectConnectorSpringDamper::GetAvailableJacobians() const
+{
+	if (!parameters.springForceUserFunction && HasConstantMarkerJacobians(Marker::Position))
+	{
+		return (JacobianType::Type)(JacobianType::ODE2_ODE2 + JacobianType::ODE2_ODE2_t + JacobianType::ODE2_ODE2_function + JacobianType::ODE2_ODE2_t_function);
+	}
+	return JacobianType::_None;
 }
 
 ////! Flags to determine, which output variables are available (displacment, velocity, stress, ...)
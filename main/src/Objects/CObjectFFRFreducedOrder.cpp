@@ -20,6 +20,7 @@
 
 #include "Autogenerated/CObjectFFRFreducedOrder.h"
 #include "Utilities/RigidBodyMath.h"
+#include "Linalg/LinearSolver.h" //for GeneralMatrix
 
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
@@ -520,13 +521,46 @@ Index CObjectFFRFreducedOrder::GetAlgebraicEquationsSize() const
 //! return the available jacobian dependencies and the jacobians which are available as a function; if jacobian dependencies exist but are not available as a function, it is computed numerically; can be combined with 2^i enum flags
 JacobianType::Type CObjectFFRFreducedOrder::GetAvailableJacobians() const
 {
+	Index jacobianType = JacobianType::_None;
 	if (GetAlgebraicEquationsSize() != 0)
 	{
-		return (JacobianType::Type)(JacobianType::AE_ODE2 + JacobianType::AE_ODE2_function);
+		jacobianType += JacobianType::AE_ODE2 + JacobianType::AE_ODE2_function;
+	}
+#ifndef computeFFRFfullTerms
+	//without full FFRF terms and user function, ODE2 LHS is linear: K_ff*q_f + D_ff*q_f_t
+	if (!parameters.forceUserFunction)
+	{
+		jacobianType += JacobianType::ODE2_ODE2 + JacobianType::ODE2_ODE2_t + JacobianType::ODE2_ODE2_function + JacobianType::ODE2_ODE2_t_function + JacobianType::ODE2_ODE2_sparse;
+	}
+#endif
+	return (JacobianType::Type)jacobianType;
+}
+
+//! add factor*(stiffnessMatrixReduced) [velocityLevel=false] or factor*(dampingMatrixReduced) [velocityLevel=true] for flexible coordinates directly to system jacobian;
+//! sparse PyMatrixContainer matrices are added as sparse triplets, avoiding a dense local jacobian of size nODE2 x nODE2
+void CObjectFFRFreducedOrder::AddJacobianODE2_ODE2(GeneralMatrix& jacobianGM, Real factor, const ArrayIndex& ltgODE2, bool velocityLevel) const
+{
+	if (!parameters.computeFFRFterms) { return; }
+
+	const PyMatrixContainer& matrix = velocityLevel ? parameters.dampingMatrixReduced : parameters.stiffnessMatrixReduced;
+	if (matrix.NumberOfRows() == 0) { return; }
+
+	//flexible coordinates follow rigid body coordinates
+	Index nODE2Rigid = GetCNode(rigidBodyNodeNumber)->GetNumberOfODE2Coordinates();
+	Index nODE2FF = GetCNode(genericNodeNumber)->GetNumberOfODE2Coordinates();
+	ArrayIndex ltgFF(nODE2FF);
+	for (Index i = 0; i < nODE2FF; i++)
+	{
+		ltgFF.Append(ltgODE2[nODE2Rigid + i]);
+	}
+
+	if (matrix.UseDenseMatrix())
+	{
+		jacobianGM.AddSubmatrix(matrix.GetInternalDenseMatrix(), factor, ltgFF, ltgFF);
 	}
 	else
 	{
-		return JacobianType::_None;
+		jacobianGM.AddSparseTriplets(matrix.GetInternalSparseTripletMatrix(), factor, ltgFF, ltgFF);
 	}
 }
 
@@ -233,6 +233,27 @@ void CObjectGenericODE2::ComputeODE2RHS(Vector& ode2Rhs) const
 
 }
 
+//! return the available jacobian dependencies and the jacobians which are available as a function; analytic jacobians are only available without forceUserFunction
+JacobianType::Type CObjectGenericODE2::GetAvailableJacobians() const
+{
+	if (!parameters.forceUserFunction)
+	{
+		return (JacobianType::Type)(JacobianType::ODE2_ODE2 + JacobianType::ODE2_ODE2_t + JacobianType::ODE2_ODE2_function + JacobianType::ODE2_ODE2_t_function);
+	}
+	return JacobianType::_None;
+}
+
+//! Computational function: compute Jacobian of ODE2 LHS equations w.r.t. ODE coordinates (stiffness matrix) and w.r.t. ODE_t coordinates (damping matrix)
+void CObjectGenericODE2::ComputeJacobianODE2_ODE2(ResizableMatrix& jacobian, ResizableMatrix& jacobian_ODE2_t) const
+{
+	Index nODE2 = GetODE2Size();
+	if (parameters.stiffnessMatrix.NumberOfRows() != 0) { jacobian.CopyFrom(parameters.stiffnessMatrix); }
+	else { jacobian.SetNumberOfRowsAndColumns(nODE2, nODE2); jacobian.SetAll(0.); }
+
+	if (parameters.dampingMatrix.NumberOfRows() != 0) { jacobian_ODE2_t.CopyFrom(parameters.dampingMatrix); }
+	else { jacobian_ODE2_t.SetNumberOfRowsAndColumns(nODE2, nODE2); jacobian_ODE2_t.SetAll(0.); }
+}
+
 //! Flags to determine, which access (forces, moments, connectors, ...) to object are possible
 AccessFunctionType CObjectGenericODE2::GetAccessFunctionTypes() const
 {
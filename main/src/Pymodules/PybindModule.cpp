@@ -74,6 +74,7 @@ using namespace pybind11::literals; //brings in the '_a' literals; e.g. for shor
 #include "System/ItemIndices.h"
 
 #include "Solver/CSolverImplicitSecondOrder.h"
+#include "Solver/CSolverExplicit.h"
 #include "Solver/CSolverStatic.h"
 #include "Solver/MainSolverBase.h"
 #include "Autogenerated/MainSolver.h" //pybind access to solvers
@@ -562,8 +563,18 @@ PYBIND11_MODULE(exudynCPP, m) {
 				CSolverImplicitSecondOrderTimeInt solverSO;
 				solverSO.SolveSystem(*(ms.GetCSystem()), simulationSettings);
 			}
+			else if (solverName == "RungeKutta4")
+			{
+				CSolverExplicitTimeInt solverExplicit(ExplicitIntegrationMethod::RungeKutta4);
+				solverExplicit.SolveSystem(*(ms.GetCSystem()), simulationSettings);
+			}
+			else if (solverName == "DormandPrince45")
+			{
+				CSolverExplicitTimeInt solverExplicit(ExplicitIntegrationMethod::DormandPrince45);
+				solverExplicit.SolveSystem(*(ms.GetCSystem()), simulationSettings);
+			}
 			else {
-				PyError(STDstring("SystemContainer::TimeIntegrationSolve: invalid solverName '") + solverName + "'; options are: RungeKutta1 or GeneralizedAlpha");
+				PyError(STDstring("SystemContainer::TimeIntegrationSolve: invalid solverName '") + solverName + "'; options are: RungeKutta1, RungeKutta4, DormandPrince45 or GeneralizedAlpha");
 			}
 		}
 		catch (const EXUexception& ex)
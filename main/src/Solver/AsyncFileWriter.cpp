@@ -0,0 +1,163 @@
+/** ***********************************************************************************************
+* @brief		Implementation of AsyncFileWriter
+*
+* @author		agent
+* @date			2026-10-16
+*
+* @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+* @note			Bug reports, support and further information:
+* 				- email: johannes.gerstmayr@uibk.ac.at
+* 				- weblink: missing
+*
+*
+************************************************************************************************ */
+
+#include "Utilities/BasicFunctions.h" //for GetTimeInSeconds
+#include "Solver/AsyncFileWriter.h"
+#include <chrono>
+#include <cstring> //memcpy
+
+//! size of record header: int32 fileIndex, int32 numberOfValues; keeps values 8-byte aligned in ring buffer
+const size_t asyncRecordHeaderSize = 2 * sizeof(int32_t);
+
+AsyncFileWriter::AsyncFileWriter():
+	headPosition(0), tailPosition(0), recordPosition(0), stopRequested(false), discardRequested(false),
+	binaryMode(false), blockIfBufferFull(true), droppedRecords(0), writeTime(0.)
+{
+}
+
+void AsyncFileWriter::Start(std::ofstream* solutionFile, const std::vector<std::ofstream*>& sensorFiles, bool binary,
+	Index bufferSize, Index maximumRowSize, bool blockIfFull)
+{
+	Stop(false); //in case that previous simulation did not finish regularly
+
+	files.clear();
+	files.push_back(solutionFile);
+	files.insert(files.end(), sensorFiles.begin(), sensorFiles.end());
+	binaryMode = binary;
+	blockIfBufferFull = blockIfFull;
+
+	//ring buffer size is multiple of 8 bytes, such that records never split single values
+	size_t minimumSize = 2 * (asyncRecordHeaderSize + maximumRowSize * sizeof(Real));
+	size_t size = EXUstd::Maximum((size_t)bufferSize, minimumSize);
+	ringBuffer.resize(((size + 7) / 8) * 8);
+
+	headPosition = 0;
+	tailPosition = 0;
+	recordPosition = 0;
+	stopRequested = false;
+	discardRequested = false;
+	droppedRecords = 0;
+	writeTime = 0.;
+
+	writerThread = std::thread(&AsyncFileWriter::Run, this);
+}
+
+void AsyncFileWriter::Stop(bool flush)
+{
+	if (!IsRunning()) { return; }
+
+	if (!flush) { discardRequested.store(true, std::memory_order_release); }
+	stopRequested.store(true, std::memory_order_release);
+	writerThread.join();
+
+	files.clear();
+	ringBuffer.clear();
+	ringBuffer.shrink_to_fit();
+}
+
+bool AsyncFileWriter::BeginRecord(Index fileIndex, Index numberOfValues)
+{
+	uint64_t head = headPosition.load(std::memory_order_relaxed);
+	uint64_t recordSize = asyncRecordHeaderSize + numberOfValues * sizeof(Real);
+
+	if (recordSize > ringBuffer.size()) //row larger than maximumRowSize in Start(...); would never fit
+	{
+		droppedRecords++;
+		return false;
+	}
+
+	//back-pressure: wait for writer thread or drop record
+	while (ringBuffer.size() - (head - tailPosition.load(std::memory_order_acquire)) < recordSize)
+	{
+		if (!blockIfBufferFull)
+		{
+			droppedRecords++;
+			return false;
+		}
+		std::this_thread::yield();
+	}
+
+	int32_t recordHeader[2] = { (int32_t)fileIndex, (int32_t)numberOfValues };
+	CopyToBuffer(head, (const char*)recordHeader, asyncRecordHeaderSize);
+	recordPosition = head + asyncRecordHeaderSize;
+	return true;
+}
+
+void AsyncFileWriter::AddValues(const Real* values, Index numberOfValues)
+{
+	CopyToBuffer(recordPosition, (const char*)values, numberOfValues * sizeof(Real));
+	recordPosition += numberOfValues * sizeof(Real);
+}
+
+void AsyncFileWriter::CopyToBuffer(uint64_t position, const char* source, size_t numberOfBytes)
+{
+	size_t start = (size_t)(position % ringBuffer.size());
+	size_t firstPart = EXUstd::Minimum(numberOfBytes, ringBuffer.size() - start);
+	memcpy(&ringBuffer[start], source, firstPart);
+	if (firstPart < numberOfBytes) { memcpy(&ringBuffer[0], source + firstPart, numberOfBytes - firstPart); }
+}
+
+void AsyncFileWriter::CopyFromBuffer(uint64_t position, char* destination, size_t numberOfBytes) const
+{
+	size_t start = (size_t)(position % ringBuffer.size());
+	size_t firstPart = EXUstd::Minimum(numberOfBytes, ringBuffer.size() - start);
+	memcpy(destination, &ringBuffer[start], firstPart);
+	if (firstPart < numberOfBytes) { memcpy(destination + firstPart, &ringBuffer[0], numberOfBytes - firstPart); }
+}
+
+void AsyncFileWriter::Run()
+{
+	std::vector<Real> row; //values of one record; avoids formatting directly from ring buffer with wrap around
+	uint64_t tail = tailPosition.load(std::memory_order_relaxed);
+
+	while (!discardRequested.load(std::memory_order_acquire))
+	{
+		//stop flag must be read before head, such that all records published before Stop() are written
+		bool stop = stopRequested.load(std::memory_order_acquire);
+		uint64_t head = headPosition.load(std::memory_order_acquire);
+
+		if (head == tail)
+		{
+			if (stop) { break; }
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			continue;
+		}
+
+		writeTime -= EXUstd::GetTimeInSeconds();
+		while (tail != head && !discardRequested.load(std::memory_order_relaxed))
+		{
+			int32_t recordHeader[2];
+			CopyFromBuffer(tail, (char*)recordHeader, asyncRecordHeaderSize);
+			Index nValues = (Index)recordHeader[1];
+			row.resize(nValues);
+			CopyFromBuffer(tail + asyncRecordHeaderSize, (char*)row.data(), nValues * sizeof(Real));
+
+			std::ofstream* file = files[recordHeader[0]];
+			if (binaryMode)
+			{
+				file->write((const char*)row.data(), nValues * sizeof(Real));
+			}
+			else if (nValues != 0) //same format as CSolverBase::WriteCoordinatesToFile
+			{
+				(*file) << row[0];
+				for (Index i = 1; i < nValues; i++) { (*file) << "," << row[i]; }
+				(*file) << "\n";
+			}
+
+			tail += asyncRecordHeaderSize + nValues * sizeof(Real);
+			tailPosition.store(tail, std::memory_order_release); //free space for solver
+		}
+		writeTime += EXUstd::GetTimeInSeconds();
+	}
+}
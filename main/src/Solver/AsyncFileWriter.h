@@ -0,0 +1,89 @@
+/** ***********************************************************************************************
+* @class		AsyncFileWriter
+* @brief		Background writer thread for solution and sensor files
+* @details		Details:
+* 				- the solver (single producer) copies rows of Real values (time + exported values) into a lock-free ring buffer
+* 				- the writer thread (single consumer) drains the ring buffer and writes rows as text or binary data to the files
+*				- files are owned by the writer thread between Start() and Stop(); the solver must not access them in this period
+*				- if the ring buffer is full, the solver either waits (back-pressure) or drops the row
+*
+* @author		agent
+* @date			2026-10-16
+*
+* @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+* @note			Bug reports, support and further information:
+* 				- email: johannes.gerstmayr@uibk.ac.at
+* 				- weblink: missing
+*
+*
+************************************************************************************************ */
+#ifndef ASYNCFILEWRITER__H
+#define ASYNCFILEWRITER__H
+
+#include "Utilities/BasicDefinitions.h"
+#include <fstream>
+#include <thread>
+#include <atomic>
+#include <vector>
+
+//! writes rows of Real values to solution and sensor files in a separate thread
+class AsyncFileWriter
+{
+private:
+	std::vector<char> ringBuffer;				//!< ring buffer containing records: [int32 fileIndex, int32 numberOfValues, values]
+	std::atomic<uint64_t> headPosition;			//!< total number of bytes published by solver
+	std::atomic<uint64_t> tailPosition;			//!< total number of bytes consumed by writer thread
+	uint64_t recordPosition;					//!< write position of record which is currently filled by solver (not yet published)
+	std::atomic<bool> stopRequested;			//!< signals writer thread to finish, as soon as ring buffer is empty
+	std::atomic<bool> discardRequested;			//!< signals writer thread to finish immediately, discarding buffered records
+
+	std::thread writerThread;					//!< thread which writes data to files
+	std::vector<std::ofstream*> files;			//!< files[0] is solution file, files[i+1] is sensor file i; may contain nullptr
+	bool binaryMode;							//!< true: raw binary rows; false: comma separated text rows
+	bool blockIfBufferFull;						//!< true: solver waits if ring buffer is full; false: rows are dropped
+	Index droppedRecords;						//!< number of rows which have been dropped due to full ring buffer
+	Real writeTime;								//!< time spent by writer thread for writing; only valid after Stop()
+
+public:
+	AsyncFileWriter();
+	~AsyncFileWriter() { Stop(false); }
+
+	//! return true, if writer thread is running and files are owned by writer
+	bool IsRunning() const { return writerThread.joinable(); }
+
+	//! start writer thread for given files (solution file may be nullptr, sensor files may contain nullptr);
+	//! bufferSize is increased to hold at least two rows of maximumRowSize values
+	void Start(std::ofstream* solutionFile, const std::vector<std::ofstream*>& sensorFiles, bool binary,
+		Index bufferSize, Index maximumRowSize, bool blockIfFull);
+
+	//! stop writer thread; if flush is true, all buffered rows are written, otherwise they are discarded
+	void Stop(bool flush);
+
+	//! reserve space for a row with numberOfValues Real values for file fileIndex (0=solution file, i+1=sensor i);
+	//! returns false if row is dropped (ring buffer full and blockIfBufferFull=false)
+	bool BeginRecord(Index fileIndex, Index numberOfValues);
+
+	//! copy values into current record; total number of values must match BeginRecord(...)
+	void AddValues(const Real* values, Index numberOfValues);
+
+	//! publish current record to writer thread
+	void EndRecord() { headPosition.store(recordPosition, std::memory_order_release); }
+
+	//! number of rows which have been dropped due to full ring buffer since Start()
+	Index GetDroppedRecords() const { return droppedRecords; }
+
+	//! time in seconds spent by writer thread for writing files; only valid after Stop()
+	Real GetWriteTime() const { return writeTime; }
+
+private:
+	//! main loop of writer thread
+	void Run();
+
+	//! copy bytes into ring buffer at (unbounded) position, considering wrap around
+	void CopyToBuffer(uint64_t position, const char* source, size_t numberOfBytes);
+
+	//! copy bytes from ring buffer at (unbounded) position, considering wrap around
+	void CopyFromBuffer(uint64_t position, char* destination, size_t numberOfBytes) const;
+};
+
+#endif
@@ -56,7 +56,8 @@ STDstring CSolverTimer::ToString() const
 		Real sum = Sum() / 100.;
 		ostr << "  total time   = " << total << " seconds\n";
 		ostr << "  measured time= " << Sum() << " seconds (=" << 100.*Sum() / total << "%) \n";
-		ostr << "  factorization     = " << factorization / sum << "%\n";
+		ostr << "  factorization     = " << factorization / sum << "% (" << linearSolverType << ": " << factorization << " seconds)\n";
+		if (factorizationSymbolic != 0.) { ostr << "    symbolic        = " << factorizationSymbolic / sum << "% (included in factorization)\n"; }
 		ostr << "  newtonIncrement   = " << newtonIncrement / sum << "%\n";
 		ostr << "  integrationFormula= " << integrationFormula / sum << "%\n";
 		ostr << "  ODE2RHS           = " << ODE2RHS / sum << "%\n";
@@ -69,6 +70,7 @@ STDstring CSolverTimer::ToString() const
 		ostr << "  reactionForces    = " << reactionForces / sum << "%\n";
 		ostr << "  postNewtonStep    = " << postNewton / sum << "%\n";
 		ostr << "  writeSolution     = " << writeSolution / sum << "%\n";
+		if (writeSolutionAsync != 0.) { ostr << "  writeSolutionAsync= " << writeSolutionAsync / sum << "% (background thread, not counted in sum)\n"; }
 		ostr << "  overhead          = " << overhead / sum << "%\n";
 		ostr << "  python            = " << python / sum << "%\n";
 		ostr << "  visualization/user= " << visualization / sum << "%\n";
@@ -120,9 +122,10 @@ void SolverLocalData::CleanUpMemory()
 }
 
 //! function links system matrices to according dense/sparse versions
-void SolverLocalData::SetLinearSolverType(LinearSolverType linearSolverType)
+void SolverLocalData::SetLinearSolverType(LinearSolverType linearSolverTypeInit)
 {
-	if (linearSolverType == LinearSolverType::EXUdense)
+	linearSolverType = linearSolverTypeInit;
+	if (linearSolverType == LinearSolverType::EXUdense || linearSolverType == LinearSolverType::_None)
 	{
 		systemJacobian = &systemJacobianDense;
 		systemMassMatrix = &systemMassMatrixDense;
@@ -133,6 +136,7 @@ void SolverLocalData::SetLinearSolverType(LinearSolverType linearSolverType)
 		systemJacobian = &systemJacobianSparse;
 		systemMassMatrix = &systemMassMatrixSparse;
 		jacobianAE = &jacobianAEsparse;
+		systemJacobianSparse.SetSparseSolverType(linearSolverType); //only system jacobian is factorized
 	}
 }
 
@@ -149,6 +153,29 @@ std::string SolverIterationData::ToString() const
 	{
 		ostr << "rejected modified Newton steps:      " << rejectedModifiedNewtonSteps << "\n";
 	}
+	if (linearSolverIterationsCount || linearSolverFailedCount)
+	{
+		ostr << "linear solver iterations:     " << linearSolverIterationsCount << "\n";
+		ostr << "linear solver not converged:  " << linearSolverFailedCount << "\n";
+	}
+	if (adaptiveStep && largestStepSize != 0.)
+	{
+		ostr << "rejected steps:               " << rejectedSteps << "\n";
+		ostr << "step size (min/max):          " << smallestStepSize << " / " << largestStepSize << "\n";
+	}
+#ifdef __EXUDYN_RUNTIME_CHECKS__
+	ostr << "memory allocations (total/max per step, excluding first step): " << allocationsCount << " / " << maxStepAllocations << "\n";
+	if (allocationsCount)
+	{
+		ostr << "  residual:      " << allocationsResidual << "\n";
+		ostr << "  jacobian:      " << allocationsJacobian << "\n";
+		ostr << "  factorization: " << allocationsFactorization << "\n";
+		ostr << "  output:        " << allocationsOutput << "\n";
+		ostr << "  sensors:       " << allocationsSensors << "\n";
+		ostr << "  other:         " << allocationsCount - allocationsResidual - allocationsJacobian - allocationsFactorization - 
+			allocationsOutput - allocationsSensors << "\n";
+	}
+#endif
 
 	return ostr.str();
 }
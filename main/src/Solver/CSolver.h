@@ -36,6 +36,15 @@
 #define STOPTIMER(_Expression) (timer.StopTimer(_Expression))
 #endif
 
+//allocation profiler per solver phase, counting memory allocations of arrays, vectors and matrices (see SolverIterationData)
+#ifdef __EXUDYN_RUNTIME_CHECKS__
+#define STARTALLOCATIONCOUNT(_Expression) (_Expression -= GetLinalgAllocationCount())
+#define STOPALLOCATIONCOUNT(_Expression) (_Expression += GetLinalgAllocationCount())
+#else
+#define STARTALLOCATIONCOUNT(_Expression) 
+#define STOPALLOCATIONCOUNT(_Expression) 
+#endif
+
 #ifdef __FAST_EXUDYN_LINALG
 #define Verbose(_Expression1, _Expression2) 
 #define IsVerbose(_Expression1) (false)
@@ -57,7 +66,7 @@ namespace EXUstd
 		int nthreads = (int)simulationSettings.numberOfThreads; //activated /Zc:twoPhase- in compiler options to suppress warning
 		if (nthreads < 1 || nthreads > 100) { PyError("simulationSettings.numberOfThreads is out of range(1..100)!"); return; }
 
-		if (nthreads != omp_get_num_threads())
+		if (nthreads != omp_get_max_threads()) //omp_get_num_threads() would always return 1 outside of parallel regions
 		{
 			omp_set_num_threads(nthreads);
 
@@ -29,6 +29,7 @@
 
 #include "Utilities/TimerStructure.h"
 #include <fstream>
+#include <cstring> //for memcmp
 
 namespace py = pybind11;	//for py::object
 
@@ -52,6 +53,19 @@ bool CSolverBase::InitializeSolver(CSystem& computationalSystem, const Simulatio
 	return false;
 }
 
+//! open file with user-provided write buffer, which must exist until the file is closed;
+//! libstdc++ only accepts the buffer before opening, MSVC only after opening (before any output)
+void OpenBufferedFile(std::ofstream& stream, const STDstring& fileName, std::ios_base::openmode mode, std::vector<char>& buffer)
+{
+#ifdef _MSC_VER
+	stream.open(fileName, mode);
+	if (stream.is_open()) { stream.rdbuf()->pubsetbuf(buffer.data(), buffer.size()); }
+#else
+	stream.rdbuf()->pubsetbuf(buffer.data(), buffer.size());
+	stream.open(fileName, mode);
+#endif
+}
+
 //! initialize output files; called from InitializeSolver(); must be done at the very beginning, as otherwise, no information is written!
 void CSolverBase::InitializeSolverOutput(CSystem& computationalSystem, const SimulationSettings& simulationSettings)
 {
@@ -79,12 +93,18 @@ void CSolverBase::InitializeSolverOutput(CSystem& computationalSystem, const Sim
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 	//open solution file
 	output.writeToSolutionFile = solutionSettings.writeSolutionToFile;
+	//binary files must be opened in binary mode, otherwise line ends are converted on Windows
+	auto binaryMode = solutionSettings.binarySolutionFile ? std::ofstream::binary : (std::ios_base::openmode)0;
+	//large write buffer reduces number of file system calls
+	Index bufferSize = EXUstd::Maximum(solutionSettings.outputBufferSize, (Index)4096);
+
 	if (solutionFileName != "" && output.writeToSolutionFile)
 	{
 		CheckPathAndCreateDirectories(solutionFileName);
 
-		if (solutionSettings.appendToFile) { file.solutionFile.open(solutionFileName, std::ofstream::app); }
-		else { file.solutionFile.open(solutionFileName, std::ofstream::out); }
+		file.solutionFileBuffer.resize(bufferSize);
+		if (solutionSettings.appendToFile) { OpenBufferedFile(file.solutionFile, solutionFileName, std::ofstream::app | binaryMode, file.solutionFileBuffer); }
+		else { OpenBufferedFile(file.solutionFile, solutionFileName, std::ofstream::out | binaryMode, file.solutionFileBuffer); }
 		if (!file.solutionFile.is_open()) //failed to open file ...  e.g. invalid file name
 		{
 			output.writeToSolutionFile = false;
@@ -121,18 +141,22 @@ void CSolverBase::InitializeSolverOutput(CSystem& computationalSystem, const Sim
 	//open sensor files
 	//for every sensor there is an according enty in sensorFileList (may be Null pointer)
 	//files need to be closed at any exit point!!!
+	//buffers are allocated for all sensors at once, such that buffer data is not moved
+	file.sensorFileBufferList.resize(computationalSystem.GetSystemData().GetCSensors().NumberOfItems());
 	for (auto item : computationalSystem.GetSystemData().GetCSensors())
 	{
 		Index cnt = 0;
 		if (item->GetWriteToFileFlag() && item->GetFileName().length() != 0)
 		{
 			std::ofstream* sensorFile = new std::ofstream;
+			std::vector<char>& sensorFileBuffer = file.sensorFileBufferList[file.sensorFileList.size()];
 			file.sensorFileList.push_back(sensorFile);
-			auto fileMode = std::ofstream::out;
-			if (solutionSettings.appendToFile) { fileMode = std::ofstream::app; }
+			auto fileMode = std::ofstream::out | binaryMode;
+			if (solutionSettings.appendToFile) { fileMode = std::ofstream::app | binaryMode; }
 
 			CheckPathAndCreateDirectories(item->GetFileName());
-			sensorFile->open(item->GetFileName(), fileMode);
+			sensorFileBuffer.resize(bufferSize);
+			OpenBufferedFile(*sensorFile, item->GetFileName(), fileMode, sensorFileBuffer);
 
 			if (!sensorFile->is_open()) //failed to open file ...  e.g. invalid file name
 			{
@@ -188,6 +212,8 @@ bool CSolverBase::InitializeSolverPreChecks(CSystem& computationalSystem, const
 	if (data.nODE1 != 0) { SysError("Solver cannot solve first order differential equations (ODE1) for now", file.solverFile); }
 
 
+	EXUstd::AssignParallelizationParameters(simulationSettings); //threads used for system computation and linear solver
+
 	if (simulationSettings.linearSolverType == LinearSolverType::EXUdense)
 	{
 		Index n = computationalSystem.GetSystemData().GetNumberOfComputationCoordinates();
@@ -196,13 +222,9 @@ bool CSolverBase::InitializeSolverPreChecks(CSystem& computationalSystem, const
 			PyWarning("The number of total coordinates (unknowns) is larger than 1000. Consider a sparse solver (SimulationSettings().linearSolverType) to reduce memory consumption and computation time.", file.solverFile);
 		}
 	}
-	else if (simulationSettings.linearSolverType == LinearSolverType::EigenSparse)
+	else if (!GeneralMatrixEigenSparse::IsSparseSolverTypeAvailable(simulationSettings.linearSolverType))
 	{
-		EXUstd::AssignParallelizationParameters(simulationSettings);
-	}
-	else
-	{
-		PyError("CSolverBase::InitializeSolverPreChecks: Unsupported simulationSettings.linearSolverType", file.solverFile);
+		PyError("CSolverBase::InitializeSolverPreChecks: Unsupported simulationSettings.linearSolverType; EigenSparseLUAMD, EigenSparseLDLT and EigenSparseLLT are only available if Exudyn is compiled with USE_EIGEN_LGPL_SOLVERS", file.solverFile);
 		data.SetLinearSolverType(LinearSolverType::_None);
 		return false;
 	}
@@ -221,6 +243,7 @@ bool CSolverBase::InitializeSolverPreChecks(CSystem& computationalSystem, const
 	//do this not earlier than here, because checks need to be done prior to writing the header
 	WriteSolutionFileHeader(computationalSystem, simulationSettings);
 	WriteSensorsFileHeader(computationalSystem, simulationSettings);
+	StartAsyncFileWriter(computationalSystem, simulationSettings); //only after headers have been written
 	return true;
 }
 
@@ -230,15 +253,9 @@ void CSolverBase::InitializeSolverData(CSystem& computationalSystem, const Simul
 {
 	conv.InitializeData();
 
-	if (simulationSettings.linearSolverType == LinearSolverType::EXUdense)
-	{
-		data.SetLinearSolverType(LinearSolverType::EXUdense);
-	}
-	else
-	{
-		data.SetLinearSolverType(LinearSolverType::EigenSparse);
-	}
-	
+	data.SetLinearSolverType(simulationSettings.linearSolverType); //dense or one of the sparse solvers; checked in InitializeSolverPreChecks
+	data.SetIterativeSolverSettings(newton.linearSolverTolerance, newton.linearSolverMaxIterations); //only used for EigenSparseIterative
+
 	data.systemMassMatrix->SetNumberOfRowsAndColumns(data.nODE2, data.nODE2);
 	data.systemJacobian->SetNumberOfRowsAndColumns(data.nSys, data.nSys);
 	data.jacobianAE->SetNumberOfRowsAndColumns(data.nODE2, data.nAE);
@@ -251,6 +268,8 @@ void CSolverBase::InitializeSolverData(CSystem& computationalSystem, const Simul
 	data.tempODE2F1.SetNumberOfItems(data.nODE2);		//temporary vector for ODE2 Jacobian
 
 	data.tempCompData = TemporaryComputationData();		//totally reset; for safety for now!
+	computationalSystem.GetParallelComputationData().SetNumberOfThreads(simulationSettings.numberOfThreads); //thread-local data for multithreaded computation
+	computationalSystem.GetBatchedObjectData().useBatchedComputation = simulationSettings.batchedObjectComputation;
 
 	//temp. structure to store start of discontinous iteration state:
 	//  done in CleanUpMemory(): data.startOfDiscIteration.Reset();
@@ -264,7 +283,15 @@ void CSolverBase::InitializeSolverData(CSystem& computationalSystem, const Simul
 	it.newtonStepsCount = 0;				//count total number of Newton iterations
 	it.newtonJacobiCount = 0;				//count total number of Jacobian computations and factorizations
 	it.rejectedModifiedNewtonSteps = 0;		//count number of rejections of modifiedNewtonMethod
+	it.linearSolverIterationsCount = 0;		//count total number of iterative linear solver iterations
+	it.linearSolverFailedCount = 0;			//count number of not converged iterative linear solves
 	it.discontinuousIterationsCount = 0;	//count total number of discontinuous iterations
+	it.rejectedSteps = 0;					//count total number of rejected steps
+	it.smallestStepSize = 0.;				//statistics of accepted step sizes; 0 = no step accepted yet
+	it.largestStepSize = 0.;
+	it.allocationsCount = 0;				//memory allocations of linalg objects in steps after first step
+	it.maxStepAllocations = 0;
+	ResetAllocationPhases();
 
 	it.newtonSteps = 0;						//consistently initialize
 	it.discontinuousIteration = 0;			//consistently initialize
@@ -364,6 +391,8 @@ bool CSolverBase::SolveSystem(CSystem& computationalSystem, const SimulationSett
 
 	globalTimers.Reset();
 	timer.Reset(simulationSettings.displayComputationTime);
+	timer.linearSolverType = simulationSettings.linearSolverType;
+	timer.factorizationSymbolic = -data.systemJacobian->GetSymbolicFactorizationTime(); //symbolic factorizations are measured by sparse solver backend
 	timer.total = -EXUstd::GetTimeInSeconds();
 	if (success)
 	{
@@ -373,6 +402,7 @@ bool CSolverBase::SolveSystem(CSystem& computationalSystem, const SimulationSett
 		}, "CSolverBase::SolveSteps");
 	}
 	timer.total += EXUstd::GetTimeInSeconds();
+	timer.factorizationSymbolic += data.systemJacobian->GetSymbolicFactorizationTime();
 
 	SolverExceptionHandling([&]
 	{
@@ -389,6 +419,26 @@ bool CSolverBase::SolveSystem(CSystem& computationalSystem, const SimulationSett
 //! main solver part: calls multiple InitializeStep(...)/PerformStep(...); do step reduction if necessary; return true if success, false else
 void CSolverBase::FinalizeSolver(CSystem& computationalSystem, const SimulationSettings& simulationSettings)
 {
+	if (asyncWriter.IsRunning())
+	{
+		//waiting for writer thread is added to solver time
+		Real flushTime = -EXUstd::GetTimeInSeconds();
+		asyncWriter.Stop(simulationSettings.solutionSettings.asyncFlushOnFinalize);
+		flushTime += EXUstd::GetTimeInSeconds();
+
+		timer.total += flushTime;
+		if (timer.useTimer)
+		{
+			timer.writeSolution += flushTime;
+			timer.writeSolutionAsync += asyncWriter.GetWriteTime();
+		}
+		if (asyncWriter.GetDroppedRecords() != 0)
+		{
+			PyWarning("asynchronous output: " + EXUstd::ToString(asyncWriter.GetDroppedRecords()) + 
+				" rows have not been written to solution/sensor files, because ring buffer was full; increase solutionSettings.asyncBufferSize or set asyncBlockIfBufferFull=True", file.solverFile);
+		}
+	}
+
 	if (IsVerboseCheck(1))
 	{
 		if (computationalSystem.GetPostProcessData()->stopSimulation)
@@ -418,7 +468,8 @@ void CSolverBase::FinalizeSolver(CSystem& computationalSystem, const SimulationS
 		}
 	}
 
-	if (simulationSettings.solutionSettings.writeFileFooter && output.writeToSolutionFile)
+	if (simulationSettings.solutionSettings.writeFileFooter && output.writeToSolutionFile && 
+		!simulationSettings.solutionSettings.binarySolutionFile) //binary files only contain data rows after header
 	{
 		file.solutionFile << "#simulation finished=" << EXUstd::GetDateTimeString() << "\n";
 		file.solutionFile << "#Solver Info:";
@@ -458,6 +509,7 @@ void CSolverBase::FinalizeSolver(CSystem& computationalSystem, const SimulationS
 		}
 	}
 	file.sensorFileList.clear();
+	file.sensorFileBufferList.clear();
 	//pout << "sensor list length=" << file.sensorFileList.size() << "\n";
 }
 
@@ -487,6 +539,7 @@ bool CSolverBase::SolveSteps(CSystem& computationalSystem, const SimulationSetti
 	{
 		computationalSystem.GetSystemData().GetCData().startOfStepState = computationalSystem.GetSystemData().GetCData().currentState; //for step reduction, disc. iteration, python functions, etc.
 		data.startOfStepStateAAlgorithmic.CopyFrom(data.aAlgorithmic);
+		Index allocationsAtStepStart = GetLinalgAllocationCount(); //allocation statistics; 0 without runtime checks
 
 		//Real t = it.currentStepIndex * it.currentStepSize + it.startTime;
 		//computationalSystem.GetSystemData().GetCData().currentState.time = it.currentTime; //update time in state --> also available in Python for user-defined functions
@@ -511,6 +564,7 @@ bool CSolverBase::SolveSteps(CSystem& computationalSystem, const SimulationSetti
 				if (it.adaptiveStep)
 				{
 					computationalSystem.GetSystemData().GetCData().currentState = computationalSystem.GetSystemData().GetCData().startOfStepState; //completely reset state including data variables and time
+					it.rejectedSteps++;
 
 					if (!ReduceStepSize(computationalSystem, simulationSettings, 1))
 					{
@@ -537,6 +591,9 @@ bool CSolverBase::SolveSteps(CSystem& computationalSystem, const SimulationSetti
 			else
 			{
 				stepAccomplished = true;
+				if (it.smallestStepSize == 0. || it.currentStepSize < it.smallestStepSize) { it.smallestStepSize = it.currentStepSize; }
+				it.largestStepSize = EXUstd::Maximum(it.largestStepSize, it.currentStepSize);
+
 				FinishStep(computationalSystem, simulationSettings); //visualization, console output, file output, ...
 
 				//in case of good Newton convergence, increase step size
@@ -550,6 +607,14 @@ bool CSolverBase::SolveSteps(CSystem& computationalSystem, const SimulationSetti
 			}
 		}
 
+		if (it.currentStepIndex > 1) //first step allocates solver workspace (jacobian, factorization, ...)
+		{
+			Index stepAllocations = GetLinalgAllocationCount() - allocationsAtStepStart;
+			it.allocationsCount += stepAllocations;
+			it.maxStepAllocations = EXUstd::Maximum(it.maxStepAllocations, stepAllocations);
+		}
+		else { ResetAllocationPhases(); } //phases only count steps after first step
+
 		it.currentStepIndex++; //increment iteration count
 		if (it.currentTime >= it.endTime - 1e-10) { simulationEndTimeReached = true; } //accept small tolerance
 	}//time integration loop
@@ -652,6 +717,7 @@ void CSolverBase::FinishStep(CSystem& computationalSystem, const SimulationSetti
 
 	if (printFile || printConsole)
 	{
+		STARTALLOCATIONCOUNT(it.allocationsOutput);
 		STARTTIMER(timer.overhead);
 		output.cpuLastTimePrinted += 2;
 		Real timeToGo = 0;
@@ -686,6 +752,7 @@ void CSolverBase::FinishStep(CSystem& computationalSystem, const SimulationSetti
 		if (IsVerbose(2)) { Verbose(2, "+++++++++++++++ STEP FINISHED ++++++++++++++\n\n"); }
 
 		STOPTIMER(timer.overhead);
+		STOPALLOCATIONCOUNT(it.allocationsOutput);
 	}
 
 	if (output.writeToSolutionFile)
@@ -696,9 +763,11 @@ void CSolverBase::FinishStep(CSystem& computationalSystem, const SimulationSetti
 			output.lastSolutionWritten = it.endTime - it.currentStepSize;
 		}
 
+		STARTALLOCATIONCOUNT(it.allocationsOutput);
 		STARTTIMER(timer.writeSolution);
 		WriteCoordinatesToFile(computationalSystem, simulationSettings);
 		STOPTIMER(timer.writeSolution);
+		STOPALLOCATIONCOUNT(it.allocationsOutput);
 	}
 
 	if (computationalSystem.GetSystemData().GetCSensors().NumberOfItems() != 0)
@@ -708,11 +777,14 @@ void CSolverBase::FinishStep(CSystem& computationalSystem, const SimulationSetti
 			output.lastSensorsWritten = it.endTime - it.currentStepSize;
 		}
 
+		STARTALLOCATIONCOUNT(it.allocationsSensors);
 		STARTTIMER(timer.writeSolution);
 		WriteSensorsToFile(computationalSystem, simulationSettings);
 		STOPTIMER(timer.writeSolution);
+		STOPALLOCATIONCOUNT(it.allocationsSensors);
 	}
 
+	STARTALLOCATIONCOUNT(it.allocationsOutput);
 	STARTTIMER(timer.visualization);
 
 	bool recordImage = false;
@@ -729,6 +801,7 @@ void CSolverBase::FinishStep(CSystem& computationalSystem, const SimulationSetti
 
 	if (simulationSettings.pauseAfterEachStep) { computationalSystem.GetPostProcessData()->WaitForUserToContinue(); }
 	STOPTIMER(timer.visualization);
+	STOPALLOCATIONCOUNT(it.allocationsOutput);
 }
 
 //! perform discontinuousIteration for static step / time step
@@ -863,9 +936,11 @@ bool CSolverBase::Newton(CSystem& computationalSystem, const SimulationSettings&
 
 	//compute initial residual:
 	data.newtonSolution.SetAll(0.); //no update yet
+	STARTALLOCATIONCOUNT(it.allocationsResidual);
 	ComputeNewtonUpdate(computationalSystem, simulationSettings); //better initial guess for Newton
 
 	ComputeNewtonResidual(computationalSystem, simulationSettings);
+	STOPALLOCATIONCOUNT(it.allocationsResidual);
 
 
 	if (newton.newtonResidualMode == 0) {
@@ -903,6 +978,7 @@ bool CSolverBase::Newton(CSystem& computationalSystem, const SimulationSettings&
 		if (data.nSys > 200) { PyProcessExecuteQueue(); computationalSystem.GetPostProcessData()->ProcessUserFunctionDrawing(); } //do this task regularly, specifically in large scale systems
 
 		it.newtonSteps++; it.newtonStepsCount++;
+		bool jacobianUpdated = false; //true, if Jacobian (or preconditioner) has been updated in this iteration
 		if (IsVerbose(3)) { Verbose(3, "  Newton: STEP "  + EXUstd::ToString(it.newtonSteps) + ":\n"); }
 		if (IsVerbose(4)) { Verbose(4, "    systemResidual = " + EXUstd::ToString(data.systemResidual) + "\n"); }
 
@@ -917,8 +993,12 @@ bool CSolverBase::Newton(CSystem& computationalSystem, const SimulationSettings&
 					", sigJacUpdate=" + EXUstd::ToString(computationalSystem.GetSolverData().signalJacobianUpdate) + "\n";
 				Verbose(2, str);
 			}
+			STARTALLOCATIONCOUNT(it.allocationsJacobian);
 			ComputeNewtonJacobian(computationalSystem, simulationSettings);
+			STOPALLOCATIONCOUNT(it.allocationsJacobian);
+			jacobianUpdated = true;
 
+			STARTALLOCATIONCOUNT(it.allocationsFactorization);
 			STARTTIMER(timer.factorization);
 
 			//STARTGLOBALTIMER(TSfinalizeMatrix);
@@ -933,6 +1013,7 @@ bool CSolverBase::Newton(CSystem& computationalSystem, const SimulationSettings&
 			}
 			//STOPGLOBALTIMER(TSfactorize);
 			STOPTIMER(timer.factorization);
+			STOPALLOCATIONCOUNT(it.allocationsFactorization);
 
 			it.newtonJacobiCount++;
 			conv.jacobianUpdateRequested = false;
@@ -947,10 +1028,30 @@ bool CSolverBase::Newton(CSystem& computationalSystem, const SimulationSettings&
 			//++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 			//now compute descent of acceleration vector with jacobian
 
+			STARTALLOCATIONCOUNT(it.allocationsFactorization);
 			STARTTIMER(timer.newtonIncrement);
-			data.systemJacobian->Solve(data.systemResidual, data.newtonSolution);
+			Index linearSolverInfo = data.systemJacobian->Solve(data.systemResidual, data.newtonSolution);
 			STOPTIMER(timer.newtonIncrement);
+			STOPALLOCATIONCOUNT(it.allocationsFactorization);
+			it.linearSolverIterationsCount += data.systemJacobian->GetNumberOfSolverIterations();
 
+			if (linearSolverInfo != 0) //iterative solver did not converge
+			{
+				it.linearSolverFailedCount++;
+				if (!jacobianUpdated)
+				{
+					//preconditioner of modified Newton may be outdated ==> repeat iteration with updated Jacobian
+					if (IsVerbose(2)) { Verbose(2, "    linear solver did not converge; update Jacobian\n"); }
+					conv.jacobianUpdateRequested = true;
+					continue;
+				}
+				if (IsVerboseCheck(1)) { VerboseWrite(1, "  linear solver did not converge with updated Jacobian\n"); }
+				conv.linearSolverFailed = true;
+				stopNewton = true;
+				continue;
+			}
+
+			STARTALLOCATIONCOUNT(it.allocationsResidual);
 			ComputeNewtonUpdate(computationalSystem, simulationSettings);
 
 
@@ -959,6 +1060,7 @@ bool CSolverBase::Newton(CSystem& computationalSystem, const SimulationSettings&
 			//++++++++++++++++++++++++++++++++++++++++++
 			//compute residual from static step increment or from integration formula:
 			ComputeNewtonResidual(computationalSystem, simulationSettings);
+			STOPALLOCATIONCOUNT(it.allocationsResidual);
 			//++++++++++++++++++++++++++++++++++++++++++
 
 			if (newton.newtonResidualMode == 0) {
@@ -1098,8 +1200,10 @@ bool CSolverBase::Newton(CSystem& computationalSystem, const SimulationSettings&
 						//++++++++++++++++++++++++++++++++++++++++++++++++++++++
 						//compute residual (for beginning of step, which means that delta_acc=0, lambda=0):
 						data.newtonSolution.SetAll(0.); //no update yet
+						STARTALLOCATIONCOUNT(it.allocationsResidual);
 						ComputeNewtonUpdate(computationalSystem, simulationSettings); //better initial guess for Newton
 						ComputeNewtonResidual(computationalSystem, simulationSettings);
+						STOPALLOCATIONCOUNT(it.allocationsResidual);
 
 						if (IsVerbose(2) && !conv.newtonSolutionDiverged) { Verbose(2, "    ... Newton restarted due to bad contractivity, divergence or iterations count\n"); }
 					}
@@ -1171,7 +1275,10 @@ void CSolverBase::WriteSolutionFileHeader(CSystem& computationalSystem, const Si
 	if (solutionSettings.exportAlgebraicCoordinates) { nAEexported = nAE; }
 	if (solutionSettings.exportDataCoordinates) { nDataExported = nData; }
 
-	std::ofstream& solFile = file.solutionFile;
+	//in binary mode, the text header is embedded into the binary header
+	bool binaryFile = solutionSettings.binarySolutionFile;
+	std::ostringstream headerText;
+	std::ostream& solFile = binaryFile ? (std::ostream&)headerText : (std::ostream&)file.solutionFile;
 
 	if (solutionSettings.writeFileHeader)
 	{
@@ -1204,6 +1311,19 @@ void CSolverBase::WriteSolutionFileHeader(CSystem& computationalSystem, const Si
 		}
 	}
 
+	//binary header is always needed to read the file; only the embedded text depends on writeFileHeader
+	if (binaryFile)
+	{
+		ArrayIndex info({ nODE2, nVel2, nAcc2, nODE1, nVel1, nAEexported, nDataExported });
+		if (!WriteBinaryFileHeader(file.solutionFile, solutionSettings.coordinatesSolutionFileName, solutionSettings.appendToFile, 
+			headerText.str(), info, 1 + nODE2 + nVel2 + nAcc2 + nODE1 + nVel1 + nAEexported + nDataExported))
+		{
+			SysError(STDstring("appendToFile: existing binary solution file '") + solutionSettings.coordinatesSolutionFileName + 
+				"' has incompatible header (number of columns, size of Real or number of written coordinates differ); solution file is not written", file.solverFile);
+			file.solutionFile.close();
+			output.writeToSolutionFile = false;
+		}
+	}
 }
 
 
@@ -1229,6 +1349,39 @@ void CSolverBase::WriteCoordinatesToFile(const CSystem& computationalSystem, con
 
 		output.lastSolutionWritten += solutionSettings.solutionWritePeriod;
 		output.lastSolutionWritten = EXUstd::Maximum(output.lastSolutionWritten, t); //never accept smaller values ==> for adaptive solver
+
+		if (asyncWriter.IsRunning()) //only copy values; formatting and output are done by writer thread
+		{
+			Index nValues = 1 + solutionU.NumberOfItems();
+			if (solutionSettings.exportVelocities && !isStatic) { nValues += solutionV.NumberOfItems(); }
+			if (solutionSettings.exportAccelerations && !isStatic) { nValues += solutionA.NumberOfItems(); }
+			if (solutionSettings.exportAlgebraicCoordinates) { nValues += solutionLambda.NumberOfItems(); }
+			if (solutionSettings.exportDataCoordinates) { nValues += solutionData.NumberOfItems(); }
+
+			if (asyncWriter.BeginRecord(0, nValues))
+			{
+				asyncWriter.AddValues(&t, 1);
+				asyncWriter.AddValues(solutionU.GetDataPointer(), solutionU.NumberOfItems());
+				if (solutionSettings.exportVelocities && !isStatic) { asyncWriter.AddValues(solutionV.GetDataPointer(), solutionV.NumberOfItems()); }
+				if (solutionSettings.exportAccelerations && !isStatic) { asyncWriter.AddValues(solutionA.GetDataPointer(), solutionA.NumberOfItems()); }
+				if (solutionSettings.exportAlgebraicCoordinates) { asyncWriter.AddValues(solutionLambda.GetDataPointer(), solutionLambda.NumberOfItems()); }
+				if (solutionSettings.exportDataCoordinates) { asyncWriter.AddValues(solutionData.GetDataPointer(), solutionData.NumberOfItems()); }
+				asyncWriter.EndRecord();
+			}
+			return;
+		}
+
+		if (solutionSettings.binarySolutionFile) //raw data, no formatting; same column order as text file
+		{
+			solFile.write((const char*)&t, sizeof(Real));
+			WriteBinaryVector(solFile, solutionU);
+			if (solutionSettings.exportVelocities && !isStatic) { WriteBinaryVector(solFile, solutionV); }
+			if (solutionSettings.exportAccelerations && !isStatic) { WriteBinaryVector(solFile, solutionA); }
+			if (solutionSettings.exportAlgebraicCoordinates) { WriteBinaryVector(solFile, solutionLambda); }
+			if (solutionSettings.exportDataCoordinates) { WriteBinaryVector(solFile, solutionData); }
+			return;
+		}
+
 		solFile << t;
 
 		for (Index k = 0; k < solutionU.NumberOfItems(); k++) {
@@ -1263,6 +1416,93 @@ void CSolverBase::WriteCoordinatesToFile(const CSystem& computationalSystem, con
 }
 
 
+//! write header of binary solution or sensor file (all integers are int32):
+//!   identifier "EXUDYNBF", format version, byte order mark (=1), header size in bytes (=offset of data), size of Real,
+//!   number of columns (incl. time), number of info integers, length of text header, info integers, text header;
+//!   zero padding aligns data to 8 bytes, such that the data rows can be memory-mapped
+//! if appendToFile and the file already has content, no second header is written (readers expect one header);
+//!   the existing header is checked instead and false is returned if its layout differs (rows could not be read)
+bool CSolverBase::WriteBinaryFileHeader(std::ofstream& binaryFile, const STDstring& fileName, bool appendToFile, 
+	const STDstring& headerText, const ArrayIndex& info, Index numberOfColumns)
+{
+	const char identifier[8] = { 'E','X','U','D','Y','N','B','F' };
+	const Index nFixedEntries = 7;
+
+	if (appendToFile)
+	{
+		std::ifstream existingFile(fileName, std::ifstream::binary | std::ifstream::ate);
+		if (existingFile.is_open() && existingFile.tellg() > 0)
+		{
+			existingFile.seekg(0);
+			char existingIdentifier[8];
+			int32_t existingFixedEntries[nFixedEntries];
+			existingFile.read(existingIdentifier, sizeof(existingIdentifier));
+			existingFile.read((char*)existingFixedEntries, sizeof(existingFixedEntries));
+			if (!existingFile || std::memcmp(existingIdentifier, identifier, sizeof(identifier)) != 0 ||
+				existingFixedEntries[3] != (int32_t)sizeof(Real) || existingFixedEntries[4] != (int32_t)numberOfColumns ||
+				existingFixedEntries[5] != (int32_t)info.NumberOfItems())
+			{
+				return false;
+			}
+			for (Index value : info)
+			{
+				int32_t existingValue;
+				existingFile.read((char*)&existingValue, sizeof(int32_t));
+				if (!existingFile || existingValue != (int32_t)value) { return false; }
+			}
+			return true; //header matches; rows are appended
+		}
+	}
+
+	Index headerSize = sizeof(identifier) + sizeof(int32_t) * (nFixedEntries + info.NumberOfItems()) + (Index)headerText.size();
+	Index padding = (8 - headerSize % 8) % 8;
+	headerSize += padding;
+
+	int32_t fixedEntries[nFixedEntries] = { 1, 1, (int32_t)headerSize, (int32_t)sizeof(Real), (int32_t)numberOfColumns,
+		(int32_t)info.NumberOfItems(), (int32_t)headerText.size() };
+
+	binaryFile.write(identifier, sizeof(identifier));
+	binaryFile.write((const char*)fixedEntries, sizeof(fixedEntries));
+	for (Index value : info)
+	{
+		int32_t value32 = (int32_t)value;
+		binaryFile.write((const char*)&value32, sizeof(int32_t));
+	}
+	binaryFile.write(headerText.c_str(), headerText.size());
+	for (Index i = 0; i < padding; i++) { binaryFile.put(0); }
+	return true;
+}
+
+//! start background writer thread for solution and sensor files; ring buffer must hold the largest row
+void CSolverBase::StartAsyncFileWriter(CSystem& computationalSystem, const SimulationSettings& simulationSettings)
+{
+	const SolutionSettings& solutionSettings = simulationSettings.solutionSettings;
+	if (!solutionSettings.writeAsynchronously) { return; }
+
+	Index nODE2, nODE1, nAE, nData;
+	computationalSystem.GetSystemData().GetNumberOfComputationCoordinates(nODE2, nODE1, nAE, nData);
+	Index maximumRowSize = 1 + 3 * nODE2 + nAE + nData; //upper bound: time, coordinates, velocities, accelerations, ...
+
+	bool writeSensors = false;
+	Index cnt = 0;
+	for (auto item : computationalSystem.GetSystemData().GetCSensors())
+	{
+		if (cnt < file.sensorFileList.size() && file.sensorFileList[cnt] != nullptr)
+		{
+			writeSensors = true;
+			item->GetSensorValues(computationalSystem.GetSystemData(), output.sensorValuesTemp, ConfigurationType::Initial);
+			maximumRowSize = EXUstd::Maximum(maximumRowSize, 1 + output.sensorValuesTemp.NumberOfItems());
+		}
+		cnt++;
+	}
+
+	if (output.writeToSolutionFile || writeSensors)
+	{
+		asyncWriter.Start(output.writeToSolutionFile ? &file.solutionFile : nullptr, file.sensorFileList, 
+			solutionSettings.binarySolutionFile, solutionSettings.asyncBufferSize, maximumRowSize, solutionSettings.asyncBlockIfBufferFull);
+	}
+}
+
 //! write unique sensor file header, depending on static/dynamic simulation
 void CSolverBase::WriteSensorsFileHeader(CSystem& computationalSystem, const SimulationSettings& simulationSettings)
 {
@@ -1271,7 +1511,12 @@ void CSolverBase::WriteSensorsFileHeader(CSystem& computationalSystem, const Sim
 	{
 		if (file.sensorFileList.size() >= cnt && file.sensorFileList[cnt] != nullptr)
 		{
-			std::ofstream* sFile = file.sensorFileList[cnt];
+			//in binary mode, the text header is embedded into the binary header
+			bool binaryFile = simulationSettings.solutionSettings.binarySolutionFile;
+			std::ostringstream headerText;
+			std::ostream* sFile = file.sensorFileList[cnt];
+			if (binaryFile) { sFile = &headerText; }
+
 			(*sFile) << "#Exudyn " << GetSolverName() << " ";
 			if (IsStaticSolver()) { (*sFile) << "static "; }
 			(*sFile) << "sensor output file\n";
@@ -1287,6 +1532,20 @@ void CSolverBase::WriteSensorsFileHeader(CSystem& computationalSystem, const Sim
 
 			(*sFile) << "#number of sensor values = " << output.sensorValuesTemp.NumberOfItems() << "\n";
 			(*sFile) << "#\n";
+
+			if (binaryFile)
+			{
+				ArrayIndex info({ output.sensorValuesTemp.NumberOfItems() });
+				if (!WriteBinaryFileHeader(*file.sensorFileList[cnt], item->GetFileName(), simulationSettings.solutionSettings.appendToFile,
+					headerText.str(), info, 1 + output.sensorValuesTemp.NumberOfItems()))
+				{
+					SysError(STDstring("appendToFile: existing binary sensor file '") + item->GetFileName() + 
+						"' has incompatible header (number of sensor values or size of Real differ); sensor file is not written", file.solverFile);
+					file.sensorFileList[cnt]->close();
+					delete file.sensorFileList[cnt];
+					file.sensorFileList[cnt] = nullptr; //mark this ofstream as unwriteable
+				}
+			}
 		}
 		cnt++;
 	}
@@ -1314,10 +1573,30 @@ void CSolverBase::WriteSensorsToFile(const CSystem& computationalSystem, const S
 			{
 				std::ofstream* sFile = file.sensorFileList[cnt];
 
-				(*sFile) << t;
-				
 				item->GetSensorValues(computationalSystem.GetSystemData(), output.sensorValuesTemp, ConfigurationType::Current);
 
+				if (asyncWriter.IsRunning()) //sensor file cnt is file cnt+1 in writer
+				{
+					if (asyncWriter.BeginRecord(cnt + 1, 1 + output.sensorValuesTemp.NumberOfItems()))
+					{
+						asyncWriter.AddValues(&t, 1);
+						asyncWriter.AddValues(output.sensorValuesTemp.GetDataPointer(), output.sensorValuesTemp.NumberOfItems());
+						asyncWriter.EndRecord();
+					}
+					cnt++;
+					continue;
+				}
+
+				if (solutionSettings.binarySolutionFile)
+				{
+					sFile->write((const char*)&t, sizeof(Real));
+					WriteBinaryVector(*sFile, output.sensorValuesTemp);
+					cnt++;
+					continue;
+				}
+
+				(*sFile) << t;
+
 				for (auto value : output.sensorValuesTemp)
 				{
 					(*sFile) << "," << value;
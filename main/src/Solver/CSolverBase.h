@@ -31,6 +31,7 @@
 
 #include "Linalg/LinearSolver.h" //for GeneralMatrixEXUdense
 #include "Solver/CSolver.h"
+#include "Solver/AsyncFileWriter.h"
 
 class CSystem;
 
@@ -45,6 +46,7 @@ public: //made public for simpler access via pybind; nevertheless, C++ functions
 	SolverOutputData output;
 	SolverFileData file;
 	NewtonSettings newton; //copy of timeInt or staticSolver (depending on solver)
+	AsyncFileWriter asyncWriter; //background writer thread for solution and sensor files (solutionSettings.writeAsynchronously)
 public:
 	CSolverBase()
 	{
@@ -57,6 +59,7 @@ public:
 		//data re-initialization procedure (total clean up)
 		//general.InitializeData();
 		output.InitializeData();
+		asyncWriter.Stop(false); //writer may still own files, if previous simulation did not finish regularly
 		file = SolverFileData(); //reset files, for safety
 
 		//timer not initialized, because it needs information if timings are required
@@ -128,6 +131,16 @@ public:
 	//! main solver part: calls multiple InitializeStep(...)/DiscontinuousIteration(...)/FinishStep(...); do step reduction if necessary; return true if success, false else
 	virtual bool SolveSteps(CSystem& computationalSystem, const SimulationSettings& simulationSettings);
 
+	//! reset per-phase counters of allocation profiler (it.allocationsResidual, ...); these only count steps after the first step
+	void ResetAllocationPhases()
+	{
+		it.allocationsResidual = 0;
+		it.allocationsJacobian = 0;
+		it.allocationsFactorization = 0;
+		it.allocationsOutput = 0;
+		it.allocationsSensors = 0;
+	}
+
 	//! update currentTime (and load factor); MUST be overwritten in special solver class
 	virtual void UpdateCurrentTime(CSystem& computationalSystem, const SimulationSettings& simulationSettings) { CHECKandTHROWstring("CSolverBase::illegal call"); }
 
@@ -170,6 +183,20 @@ public:
 
 	//! write unique sensor solution file
 	virtual void WriteSensorsToFile(const CSystem& computationalSystem, const SimulationSettings& simulationSettings);
+
+	//! write header of binary solution or sensor file, containing text header and integer information (e.g. number of written coordinates);
+	//! in append mode, an existing header is checked instead of written; returns false if it does not match
+	bool WriteBinaryFileHeader(std::ofstream& binaryFile, const STDstring& fileName, bool appendToFile, 
+		const STDstring& headerText, const ArrayIndex& info, Index numberOfColumns);
+
+	//! start background writer thread, if solutionSettings.writeAsynchronously is set; files are owned by writer until FinalizeSolver(...)
+	virtual void StartAsyncFileWriter(CSystem& computationalSystem, const SimulationSettings& simulationSettings);
+
+	//! write raw Real values of vector to binary file (no formatting)
+	void WriteBinaryVector(std::ofstream& binaryFile, const Vector& vector)
+	{
+		binaryFile.write((const char*)vector.GetDataPointer(), vector.NumberOfItems() * sizeof(Real));
+	}
 	
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
@@ -0,0 +1,398 @@
+/** ***********************************************************************************************
+* @brief		Implentation for CSolverExplicitTimeInt
+*
+* @author		agent
+* @date			2026-10-16
+*
+* @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+* @note			Bug reports, support and further information:
+* 				- email: johannes.gerstmayr@uibk.ac.at
+* 				- weblink: missing
+*
+*
+************************************************************************************************ */
+
+#include "Linalg/BasicLinalg.h" //for Resizable Vector
+#include "Main/CSystem.h"
+#include "Utilities/RigidBodyMath.h"
+#include "Solver/CSolverExplicit.h"
+
+
+//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++++++++++++++++   EXPLICIT RUNGE-KUTTA SOLVER   +++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+CSolverExplicitTimeInt::CSolverExplicitTimeInt(ExplicitIntegrationMethod methodInit)
+{
+	method = methodInit;
+	useConstantMassMatrix = false;
+	massMatrixFactorized = false;
+
+	switch (method)
+	{
+	case ExplicitIntegrationMethod::RungeKutta4:
+	{
+		numberOfStages = 4;
+		rkA.SetMatrix(4, 4, {
+			0.,  0.,  0., 0.,
+			0.5, 0.,  0., 0.,
+			0.,  0.5, 0., 0.,
+			0.,  0.,  1., 0. });
+		rkB.SetVector({ 1. / 6., 1. / 3., 1. / 3., 1. / 6. });
+		rkC.SetVector({ 0., 0.5, 0.5, 1. });
+		rkE.SetNumberOfItems(0);
+		firstSameAsLast = false;
+		break;
+	}
+	case ExplicitIntegrationMethod::DormandPrince45:
+	{
+		numberOfStages = 7;
+		rkA.SetMatrix(7, 7, {
+			0., 0., 0., 0., 0., 0., 0.,
+			1. / 5., 0., 0., 0., 0., 0., 0.,
+			3. / 40., 9. / 40., 0., 0., 0., 0., 0.,
+			44. / 45., -56. / 15., 32. / 9., 0., 0., 0., 0.,
+			19372. / 6561., -25360. / 2187., 64448. / 6561., -212. / 729., 0., 0., 0.,
+			9017. / 3168., -355. / 33., 46732. / 5247., 49. / 176., -5103. / 18656., 0., 0.,
+			35. / 384., 0., 500. / 1113., 125. / 192., -2187. / 6784., 11. / 84., 0. });
+		rkB.SetVector({ 35. / 384., 0., 500. / 1113., 125. / 192., -2187. / 6784., 11. / 84., 0. });
+		rkC.SetVector({ 0., 1. / 5., 3. / 10., 4. / 5., 8. / 9., 1., 1. });
+		//b - bHat, with bHat the weights of the embedded 4th order method:
+		rkE.SetVector({ 71. / 57600., 0., -71. / 16695., 71. / 1920., -17253. / 339200., 22. / 525., -1. / 40. });
+		firstSameAsLast = true; //last stage is evaluated at final state of step
+		break;
+	}
+	default: CHECKandTHROWstring("CSolverExplicitTimeInt: invalid method");
+	}
+}
+
+//! reduce step size (1..normal, 2..severe problems); return true, if reduction was successful
+bool CSolverExplicitTimeInt::ReduceStepSize(CSystem& computationalSystem, const SimulationSettings& simulationSettings, Index severity)
+{
+	//it.currentTime is the only important value to be updated in order to reset the step time:
+	it.currentTime = computationalSystem.GetSystemData().GetCData().currentState.time;
+
+	if (it.currentStepSize > it.minStepSize)
+	{
+		if (UseErrorControl() && it.recommendedStepSize < it.currentStepSize)
+		{
+			it.currentStepSize = it.recommendedStepSize; //computed by error estimator in Newton()
+		}
+		else
+		{
+			it.currentStepSize *= 0.5;
+		}
+
+		it.currentStepSize = EXUstd::Maximum(it.minStepSize, it.currentStepSize);
+		it.recommendedStepSize = it.currentStepSize;
+		return true;
+	}
+
+	return false;
+}
+
+//! check that system has no algebraic equations
+bool CSolverExplicitTimeInt::InitializeSolverPreChecks(CSystem& computationalSystem, const SimulationSettings& simulationSettings)
+{
+	if (!CSolverBase::InitializeSolverPreChecks(computationalSystem, simulationSettings)) { return false; }
+
+	if (data.nAE != 0)
+	{
+		PyError(STDstring("CSolverExplicitTimeInt: explicit time integration cannot be used for systems with algebraic equations (constraints); use GeneralizedAlpha or replace constraints by penalty (spring-damper) connectors"), file.solverFile);
+		return false;
+	}
+	return true;
+}
+
+//! set/compute initial conditions (solver-specific!); called from InitializeSolver()
+void CSolverExplicitTimeInt::InitializeSolverInitialConditions(CSystem& computationalSystem, const SimulationSettings& simulationSettings)
+{
+	//call base class for general tasks
+	CSolverBase::InitializeSolverInitialConditions(computationalSystem, simulationSettings); //set currentState = initialState
+
+	stageU.SetNumberOfRowsAndColumns(numberOfStages, data.nODE2);
+	stageV.SetNumberOfRowsAndColumns(numberOfStages, data.nODE2);
+
+	//find nodes, which use Lie group formulation for rotations:
+	ResizableArray<const CNodeRigidBody*> lieGroupNodes;
+	for (const CNode* node : computationalSystem.GetSystemData().GetCNodes())
+	{
+		if (((Index)node->GetType() & (Index)Node::RotationLieGroup) && node->GetNumberOfODE2Coordinates() != 0)
+		{
+			lieGroupNodes.Append((const CNodeRigidBody*)node);
+		}
+	}
+
+	lieGroupRotationIndices.SetNumberOfItems(lieGroupNodes.NumberOfItems());
+	lieGroupReferenceRotations.SetNumberOfItems(3 * lieGroupNodes.NumberOfItems());
+	for (Index n = 0; n < lieGroupNodes.NumberOfItems(); n++)
+	{
+		Index nDisp = lieGroupNodes[n]->GetNumberOfDisplacementCoordinates();
+		lieGroupRotationIndices[n] = lieGroupNodes[n]->GetGlobalODE2CoordinateIndex() + nDisp;
+
+		LinkedDataVector ref = lieGroupNodes[n]->GetReferenceCoordinateVector();
+		for (Index i = 0; i < 3; i++) { lieGroupReferenceRotations[3 * n + i] = ref[nDisp + i]; }
+	}
+	lieGroupTheta.SetNumberOfItems(lieGroupReferenceRotations.NumberOfItems());
+	lieGroupTheta.SetAll(0.);
+
+	useConstantMassMatrix = simulationSettings.timeIntegration.explicitIntegration.reuseConstantMassMatrix && computationalSystem.HasConstantMassMatrix();
+	massMatrixFactorized = false;
+	it.recommendedStepSize = it.maxStepSize;
+
+	if (IsVerbose(2))
+	{
+		Verbose(2, STDstring("  Explicit integration: stages=") + EXUstd::ToString(numberOfStages) +
+			", Lie group nodes=" + EXUstd::ToString(lieGroupRotationIndices.NumberOfItems()) +
+			", constant mass matrix=" + EXUstd::ToString(useConstantMassMatrix) + "\n");
+	}
+
+	//initial accelerations:
+	Vector& solutionODE2_tt = computationalSystem.GetSystemData().GetCData().currentState.ODE2Coords_tt;
+	if (!ComputeODE2Acceleration(computationalSystem, solutionODE2_tt))
+	{
+		PyWarning("CSolverExplicitTimeInt::InitializeSolverInitialConditions: mass matrix not invertible!\nWARNING: using zero initial accelerations\n", file.solverFile);
+		solutionODE2_tt.SetAll(0.);
+	}
+	data.aAlgorithmic.CopyFrom(solutionODE2_tt);
+}
+
+//! initialize static step / time step: do some outputs, checks, etc.
+void CSolverExplicitTimeInt::UpdateCurrentTime(CSystem& computationalSystem, const SimulationSettings& simulationSettings)
+{
+	if (!it.adaptiveStep)
+	{
+		it.currentTime = it.currentStepIndex * it.currentStepSize + it.startTime; //use this to avoid round-off errors in time
+	}
+	else
+	{
+		if (UseErrorControl())
+		{
+			it.currentStepSize = EXUstd::Minimum(it.maxStepSize, EXUstd::Maximum(it.minStepSize, it.recommendedStepSize));
+		}
+		if (it.currentTime + it.currentStepSize > it.endTime)
+		{
+			it.currentStepSize = it.endTime - it.currentTime;
+		}
+		it.currentTime += it.currentStepSize;
+	}
+}
+
+//! compute accelerations acc = M^{-1}*ODE2RHS for current state; return false, if mass matrix is not invertible
+bool CSolverExplicitTimeInt::ComputeODE2Acceleration(CSystem& computationalSystem, Vector& acc)
+{
+	STARTALLOCATIONCOUNT(it.allocationsResidual);
+	STARTTIMER(timer.ODE2RHS);
+	computationalSystem.ComputeODE2RHS(data.tempCompData, data.tempODE2);
+	STOPTIMER(timer.ODE2RHS);
+	STOPALLOCATIONCOUNT(it.allocationsResidual);
+
+	if (!massMatrixFactorized || computationalSystem.GetSolverData().signalMassMatrixUpdate)
+	{
+		STARTALLOCATIONCOUNT(it.allocationsJacobian);
+		STARTTIMER(timer.massMatrix);
+		data.systemMassMatrix->SetAllZero();
+		computationalSystem.ComputeMassMatrix(data.tempCompData, *(data.systemMassMatrix));
+		STOPTIMER(timer.massMatrix);
+		STOPALLOCATIONCOUNT(it.allocationsJacobian);
+
+		STARTALLOCATIONCOUNT(it.allocationsFactorization);
+		STARTTIMER(timer.factorization);
+		data.systemMassMatrix->FinalizeMatrix();
+		Index rv = data.systemMassMatrix->Factorize();
+		STOPTIMER(timer.factorization);
+		STOPALLOCATIONCOUNT(it.allocationsFactorization);
+
+		if (rv != 0)
+		{
+			conv.massMatrixNotInvertible = true;
+			if (IsVerboseCheck(1)) { VerboseWrite(1, "  explicit integration: mass matrix not invertible\n"); }
+			return false;
+		}
+		massMatrixFactorized = useConstantMassMatrix;
+		computationalSystem.GetSolverData().signalMassMatrixUpdate = false;
+	}
+	conv.massMatrixNotInvertible = false;
+
+	STARTALLOCATIONCOUNT(it.allocationsFactorization);
+	STARTTIMER(timer.newtonIncrement);
+	data.systemMassMatrix->Solve(data.tempODE2, acc);
+	STOPTIMER(timer.newtonIncrement);
+	STOPALLOCATIONCOUNT(it.allocationsFactorization);
+
+	return true;
+}
+
+//! for Lie group nodes: interpret rotation part of (u - u0) as incremental rotation Theta (stored in lieGroupTheta) and replace it by composition of u0 and Theta
+void CSolverExplicitTimeInt::ComposeLieGroupRotations(const Vector& u0, Vector& u)
+{
+	for (Index n = 0; n < lieGroupRotationIndices.NumberOfItems(); n++)
+	{
+		Index i0 = lieGroupRotationIndices[n];
+		Vector3D rot0({ lieGroupReferenceRotations[3 * n] + u0[i0], lieGroupReferenceRotations[3 * n + 1] + u0[i0 + 1], lieGroupReferenceRotations[3 * n + 2] + u0[i0 + 2] });
+		Vector3D theta({ u[i0] - u0[i0], u[i0 + 1] - u0[i0 + 1], u[i0 + 2] - u0[i0 + 2] });
+
+		Vector3D rot = RigidBodyMath::ComposeRotationVectors(rot0, theta);
+		for (Index i = 0; i < 3; i++)
+		{
+			lieGroupTheta[3 * n + i] = theta[i];
+			u[i0 + i] = rot[i] - lieGroupReferenceRotations[3 * n + i];
+		}
+	}
+}
+
+//! compute scaled RMS error norm of the embedded error estimate; values <= 1 are accepted
+Real CSolverExplicitTimeInt::ComputeErrorNorm(const Vector& u0, const Vector& v0, const Vector& u1, const Vector& v1, const SimulationSettings& simulationSettings) const
+{
+	Real absTol = simulationSettings.timeIntegration.absoluteTolerance;
+	Real relTol = simulationSettings.timeIntegration.relativeTolerance;
+
+	Real errorSum = 0.;
+	for (Index k = 0; k < data.nODE2; k++)
+	{
+		Real errU = 0.;
+		Real errV = 0.;
+		for (Index i = 0; i < numberOfStages; i++)
+		{
+			errU += rkE[i] * stageU(i, k);
+			errV += rkE[i] * stageV(i, k);
+		}
+		errorSum += EXUstd::Square(errU / (absTol + relTol * EXUstd::Maximum(fabs(u0[k]), fabs(u1[k]))));
+		errorSum += EXUstd::Square(errV / (absTol + relTol * EXUstd::Maximum(fabs(v0[k]), fabs(v1[k]))));
+	}
+	return sqrt(errorSum / (Real)(2 * data.nODE2));
+}
+
+//! perform one explicit step (replaces Newton iteration); return false, if step failed or error is too large
+//! INPUT:  startOfStepState [u0, v0] at time t0 = currentTime - h
+//! OUTPUT: currentState [u1, v1, a1] at currentTime
+bool CSolverExplicitTimeInt::Newton(CSystem& computationalSystem, const SimulationSettings& simulationSettings)
+{
+	CSystemState& current = computationalSystem.GetSystemData().GetCData().currentState;
+	const CSystemState& startOfStep = computationalSystem.GetSystemData().GetCData().startOfStepState;
+
+	const Vector& u0 = startOfStep.ODE2Coords;
+	const Vector& v0 = startOfStep.ODE2Coords_t;
+	Vector& u = current.ODE2Coords;
+	Vector& v = current.ODE2Coords_t;
+	Vector& a = current.ODE2Coords_tt;
+
+	Real h = it.currentStepSize;
+	Real t0 = it.currentTime - h;
+	Index nODE2 = data.nODE2;
+	Index nLieGroup = lieGroupRotationIndices.NumberOfItems();
+
+	conv.linearSolverFailed = false;
+	conv.newtonConverged = false;
+	conv.newtonSolutionDiverged = false;
+	it.newtonSteps = 0; //no iterations; needed for step size increase criterion
+
+	for (Index i = 0; i < numberOfStages; i++)
+	{
+		//stage state: u = u0 + sum_j a_ij*U_j, v = v0 + sum_j a_ij*V_j
+		STARTTIMER(timer.integrationFormula);
+		u.CopyFrom(u0);
+		v.CopyFrom(v0);
+		for (Index j = 0; j < i; j++)
+		{
+			Real aij = rkA(i, j);
+			if (aij != 0.)
+			{
+				for (Index k = 0; k < nODE2; k++)
+				{
+					u[k] += aij * stageU(j, k);
+					v[k] += aij * stageV(j, k);
+				}
+			}
+		}
+		if (nLieGroup) { ComposeLieGroupRotations(u0, u); }
+		current.time = t0 + rkC[i] * h;
+		STOPTIMER(timer.integrationFormula);
+
+		if (!ComputeODE2Acceleration(computationalSystem, a))
+		{
+			conv.linearSolverFailed = true;
+			current.time = it.currentTime;
+			return false;
+		}
+
+		//stage increments:
+		STARTTIMER(timer.integrationFormula);
+		for (Index k = 0; k < nODE2; k++)
+		{
+			stageU(i, k) = h * v[k];
+			stageV(i, k) = h * a[k];
+		}
+		for (Index n = 0; n < nLieGroup; n++)
+		{
+			//rotation increment in Lie algebra: Theta_t = T^{-1}(Theta) * omega
+			Index i0 = lieGroupRotationIndices[n];
+			Vector3D omega({ v[i0], v[i0 + 1], v[i0 + 2] });
+			Vector3D thetaDot = RigidBodyMath::TSO3Inv(Vector3D({ lieGroupTheta[3 * n], lieGroupTheta[3 * n + 1], lieGroupTheta[3 * n + 2] })) * omega;
+			for (Index k = 0; k < 3; k++) { stageU(i, i0 + k) = h * thetaDot[k]; }
+		}
+		STOPTIMER(timer.integrationFormula);
+	}
+
+	//final state; for FSAL methods, the last stage already is the final state with according accelerations
+	current.time = it.currentTime;
+	if (!firstSameAsLast)
+	{
+		STARTTIMER(timer.integrationFormula);
+		u.CopyFrom(u0);
+		v.CopyFrom(v0);
+		for (Index i = 0; i < numberOfStages; i++)
+		{
+			Real bi = rkB[i];
+			for (Index k = 0; k < nODE2; k++)
+			{
+				u[k] += bi * stageU(i, k);
+				v[k] += bi * stageV(i, k);
+			}
+		}
+		if (nLieGroup) { ComposeLieGroupRotations(u0, u); }
+		STOPTIMER(timer.integrationFormula);
+
+		if (simulationSettings.timeIntegration.explicitIntegration.computeEndOfStepAccelerations)
+		{
+			if (!ComputeODE2Acceleration(computationalSystem, a))
+			{
+				conv.linearSolverFailed = true;
+				return false;
+			}
+		}
+	}
+
+	//check for diverged solution (same criterion as in Newton)
+	Real normU = u.GetL2NormSquared();
+	Real normV = v.GetL2NormSquared();
+	if (normU >= newton.maximumSolutionNorm || normV >= newton.maximumSolutionNorm || std::isnan(normU) || std::isnan(normV))
+	{
+		conv.newtonSolutionDiverged = true;
+		if (IsVerboseCheck(1)) { VerboseWrite(1, "  explicit integration: solution diverged\n"); }
+		return false;
+	}
+
+	//error control for embedded methods
+	if (UseErrorControl())
+	{
+		const Real safetyFactor = 0.9;
+		const Real minFactor = 0.2;
+		const Real maxFactor = 5.;
+
+		Real error = ComputeErrorNorm(u0, v0, u, v, simulationSettings);
+		Real factor = maxFactor;
+		if (error > 0.) { factor = EXUstd::Minimum(maxFactor, EXUstd::Maximum(minFactor, safetyFactor * pow(error, -0.2))); }
+		it.recommendedStepSize = h * factor;
+
+		if (IsVerbose(2))
+		{
+			Verbose(2, STDstring("  explicit integration: error estimate = ") + EXUstd::ToString(error) +
+				", recommended step size = " + EXUstd::ToString(it.recommendedStepSize) + "\n");
+		}
+		if (error > 1.) { return false; }
+	}
+
+	conv.newtonConverged = true;
+	return true;
+}
@@ -0,0 +1,102 @@
+/** ***********************************************************************************************
+* @class		CSolverExplicitTimeInt
+* @brief		Explicit Runge-Kutta time integration of second order systems (RK4, Dormand-Prince RK45)
+* @details		Details:
+* 				- solves M(q)*q_tt = f(q, q_t, t) for ODE2 coordinates, using the accelerations q_tt = M^{-1}*f at every stage
+*               - methods are defined by Butcher tableaus; DormandPrince45 provides an embedded error estimator for step size control
+*				- nodes with Node::RotationLieGroup (e.g. NodeRigidBodyRotVecLG) are integrated with a Lie group Runge-Kutta (Munthe-Kaas) scheme:
+*				  stage rotations are composed on SO(3) and stage velocities are transformed by the inverse tangent operator
+*				- the mass matrix is factorized only once, if all bodies have constant mass matrices
+*				- algebraic equations (constraints) are not supported
+*
+* @author		agent
+* @date			2026-10-16
+*
+* @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+* @note			Bug reports, support and further information:
+* 				- email: johannes.gerstmayr@uibk.ac.at
+* 				- weblink: missing
+*
+*
+************************************************************************************************ */
+#ifndef CSOLVEREXPLICITTIMEINT__H
+#define CSOLVEREXPLICITTIMEINT__H
+
+#include "Solver/CSolverBase.h"
+
+//! available explicit methods; defines Butcher tableau
+enum class ExplicitIntegrationMethod {
+	RungeKutta4 = 0,		//!< classical 4th order Runge-Kutta method with constant step size
+	DormandPrince45 = 1		//!< Dormand-Prince 5(4) method with embedded error estimator (FSAL)
+};
+
+//! explicit Runge-Kutta time integration solver for ODE2 systems without constraints
+class CSolverExplicitTimeInt: public CSolverBase
+{
+public: //made public for access via pybind
+	ExplicitIntegrationMethod method;	//!< integration method, defines tableau
+	Index numberOfStages;				//!< number of stages of tableau
+	Matrix rkA;							//!< Butcher tableau coefficients a_ij (lower triangular)
+	Vector rkB;							//!< Butcher tableau weights b_i
+	Vector rkC;							//!< Butcher tableau nodes c_i
+	Vector rkE;							//!< error weights b_i - bHat_i of embedded method; empty if no error estimator
+	bool firstSameAsLast;				//!< true, if last stage is evaluated at the final state of the step (FSAL)
+
+	Matrix stageU;						//!< stage increments h*velocities (rows=stages), transformed by inverse tangent operator for Lie group nodes
+	Matrix stageV;						//!< stage increments h*accelerations (rows=stages)
+
+	ArrayIndex lieGroupRotationIndices;	//!< global ODE2 index of first rotation coordinate of every Lie group node
+	Vector lieGroupReferenceRotations;	//!< reference rotation vectors of Lie group nodes (3 per node)
+	Vector lieGroupTheta;				//!< incremental rotation vectors of current stage (3 per node)
+
+	bool useConstantMassMatrix;			//!< true, if mass matrix is factorized only once
+	bool massMatrixFactorized;			//!< true, if factorized mass matrix is available for reuse
+
+public:
+	CSolverExplicitTimeInt(ExplicitIntegrationMethod methodInit = ExplicitIntegrationMethod::RungeKutta4);
+
+	//! return true, if static solver; needs to be overwritten in derived class
+	virtual bool IsStaticSolver() const override { return false; }
+
+	//! get solver name - needed for output file header and visualization window
+	virtual const STDstring GetSolverName() const override { return "explicit time integration"; }
+
+	//! return true, if method provides an embedded error estimator and step size control is active
+	bool UseErrorControl() const { return it.adaptiveStep && rkE.NumberOfItems() != 0; }
+
+	//! reduce step size (1..normal, 2..severe problems); return true, if reduction was successful
+	virtual bool ReduceStepSize(CSystem& computationalSystem, const SimulationSettings& simulationSettings, Index severity) override;
+
+	//! increase step size if convergence is good; step size is controlled by error estimator, if available
+	virtual void IncreaseStepSize(CSystem& computationalSystem, const SimulationSettings& simulationSettings) override
+	{
+		if (!UseErrorControl())
+		{
+			it.currentStepSize = EXUstd::Minimum(it.maxStepSize, 2.*it.currentStepSize);
+		}
+	}
+
+	//! check that system has no algebraic equations
+	virtual bool InitializeSolverPreChecks(CSystem& computationalSystem, const SimulationSettings& simulationSettings) override;
+
+	//! set/compute initial conditions (solver-specific!); called from InitializeSolver()
+	virtual void InitializeSolverInitialConditions(CSystem& computationalSystem, const SimulationSettings& simulationSettings) override;
+
+	//! update currentTime (and load factor); MUST be overwritten in special solver class
+	virtual void UpdateCurrentTime(CSystem& computationalSystem, const SimulationSettings& simulationSettings) override;
+
+	//! perform one explicit step (replaces Newton iteration); return false, if step failed or error is too large
+	virtual bool Newton(CSystem& computationalSystem, const SimulationSettings& simulationSettings) override;
+
+	//! compute accelerations acc = M^{-1}*ODE2RHS for current state; return false, if mass matrix is not invertible
+	bool ComputeODE2Acceleration(CSystem& computationalSystem, Vector& acc);
+
+	//! for Lie group nodes: interpret rotation part of (u - u0) as incremental rotation Theta (stored in lieGroupTheta) and replace it by composition of u0 and Theta
+	void ComposeLieGroupRotations(const Vector& u0, Vector& u);
+
+	//! compute scaled RMS error norm of the embedded error estimate; values <= 1 are accepted
+	Real ComputeErrorNorm(const Vector& u0, const Vector& v0, const Vector& u1, const Vector& v1, const SimulationSettings& simulationSettings) const;
+
+};
+
+#endif
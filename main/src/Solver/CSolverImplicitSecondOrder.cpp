@@ -38,9 +38,21 @@ bool CSolverImplicitSecondOrderTimeInt::ReduceStepSize(CSystem& computationalSys
 
 	if (it.currentStepSize > it.minStepSize)
 	{
-		it.currentStepSize *= 0.5;
+		if (useErrorControl && it.recommendedStepSize < it.currentStepSize)
+		{
+			it.currentStepSize = it.recommendedStepSize; //computed from local error estimate in DiscontinuousIteration()
+		}
+		else
+		{
+			it.currentStepSize *= 0.5;
+		}
 
 		it.currentStepSize = EXUstd::Maximum(it.minStepSize, it.currentStepSize);
+		if (useErrorControl)
+		{
+			it.recommendedStepSize = it.currentStepSize;
+			conv.jacobianUpdateRequested = true; //jacobian depends on step size
+		}
 		return true;
 	}
 
@@ -93,6 +105,7 @@ void CSolverImplicitSecondOrderTimeInt::InitializeSolverInitialConditions(CSyste
 		data.systemMassMatrix->SetAllZero();
 		computationalSystem.ComputeMassMatrix(data.tempCompData, *(data.systemMassMatrix));
 		data.systemJacobian->AddSubmatrix(*(data.systemMassMatrix));
+		data.constantMassMatrixComputed = false; //systemMassMatrix contains full mass matrix
 
 		//compute RHS
 		Vector systemRHS(data.nSys);
@@ -163,6 +176,8 @@ void CSolverImplicitSecondOrderTimeInt::InitializeSolverInitialConditions(CSyste
 	solutionAE.SetAll(0.);
 	data.aAlgorithmic.CopyFrom(solutionODE2_tt);
 
+	it.recommendedStepSize = it.maxStepSize; //initial step size for error control
+
 	if (IsVerbose(3)) { Verbose(3, STDstring("initial accelerations = ") + EXUstd::ToString(solutionODE2_tt) + "\n"); }
 
 }
@@ -176,6 +191,12 @@ void CSolverImplicitSecondOrderTimeInt::UpdateCurrentTime(CSystem& computational
 	}
 	else
 	{
+		if (useErrorControl)
+		{
+			Real stepSize = EXUstd::Minimum(it.maxStepSize, EXUstd::Maximum(it.minStepSize, it.recommendedStepSize));
+			if (stepSize != it.currentStepSize) { conv.jacobianUpdateRequested = true; } //jacobian depends on step size
+			it.currentStepSize = stepSize;
+		}
 		if (it.currentTime + it.currentStepSize > it.endTime)
 		{
 			it.currentStepSize = it.endTime - it.currentTime;
@@ -185,6 +206,55 @@ void CSolverImplicitSecondOrderTimeInt::UpdateCurrentTime(CSystem& computational
 
 }
 
+//! perform discontinuousIteration and, in case of error control, reject step if local error estimate is too large
+bool CSolverImplicitSecondOrderTimeInt::DiscontinuousIteration(CSystem& computationalSystem, const SimulationSettings& simulationSettings)
+{
+	if (!CSolverBase::DiscontinuousIteration(computationalSystem, simulationSettings)) { return false; }
+	if (!useErrorControl) { return true; }
+
+	const Real safetyFactor = 0.9;
+	const Real minFactor = 0.2;
+	const Real maxFactor = 2.;
+
+	Real error = ComputeLocalErrorNorm(computationalSystem, simulationSettings);
+	Real factor = maxFactor;
+	if (error > 0.) { factor = EXUstd::Minimum(maxFactor, EXUstd::Maximum(minFactor, safetyFactor * pow(error, -1. / 3.))); } //local error is O(h^3)
+
+	//avoid small step size changes, which would only cause jacobian updates
+	if (error <= 1. && factor >= 1. && factor < 1.2) { factor = 1.; }
+	it.recommendedStepSize = it.currentStepSize * factor;
+
+	if (IsVerbose(2))
+	{
+		Verbose(2, STDstring("  local error estimate = ") + EXUstd::ToString(error) +
+			", recommended step size = " + EXUstd::ToString(it.recommendedStepSize) + "\n");
+	}
+
+	return error <= 1.;
+}
+
+//! compute scaled RMS norm of local displacement error estimate of converged step; values <= 1 are accepted
+//! the local truncation error of Newmark-type formulas is estimated as e = (beta - 1/6)*h^2*(a1 - a0)
+Real CSolverImplicitSecondOrderTimeInt::ComputeLocalErrorNorm(CSystem& computationalSystem, const SimulationSettings& simulationSettings) const
+{
+	const Vector& u0 = computationalSystem.GetSystemData().GetCData().startOfStepState.ODE2Coords;
+	const Vector& a0 = computationalSystem.GetSystemData().GetCData().startOfStepState.ODE2Coords_tt;
+	const Vector& u1 = computationalSystem.GetSystemData().GetCData().currentState.ODE2Coords;
+	const Vector& a1 = computationalSystem.GetSystemData().GetCData().currentState.ODE2Coords_tt;
+
+	Real absTol = simulationSettings.timeIntegration.absoluteTolerance;
+	Real relTol = simulationSettings.timeIntegration.relativeTolerance;
+	Real errorFactor = fabs(newmarkBeta - 1. / 6.) * EXUstd::Square(it.currentStepSize);
+
+	Real errorSum = 0.;
+	for (Index k = 0; k < data.nODE2; k++)
+	{
+		Real err = errorFactor * (a1[k] - a0[k]);
+		errorSum += EXUstd::Square(err / (absTol + relTol * EXUstd::Maximum(fabs(u0[k]), fabs(u1[k]))));
+	}
+	return sqrt(errorSum / (Real)EXUstd::Maximum(data.nODE2, (Index)1));
+}
+
 //! initialize things at the very beginning of initialize
 void CSolverImplicitSecondOrderTimeInt::PreInitializeSolverSpecific(CSystem& computationalSystem, const SimulationSettings& simulationSettings)
 {
@@ -205,12 +275,18 @@ void CSolverImplicitSecondOrderTimeInt::PreInitializeSolverSpecific(CSystem& com
 		factJacAlgorithmic = (1. - alphaF) / (1. - alphaM);
 	}
 
+	useErrorControl = timeint.automaticStepSize && timeint.adaptiveStep;
+	useMatrixFreeResidual = timeint.generalizedAlpha.matrixFreeResidual;
+	useConstantMassMatrixCache = timeint.generalizedAlpha.reuseConstantMassMatrix && !useMatrixFreeResidual;
+
 	//useIndex2Constraints = timeint.generalizedAlpha.useIndex2Constraints; //==> now directly linked to simulationSettings;
 }
 
 //! post-initialize for solver specific tasks; called at the end of InitializeSolver
 void CSolverImplicitSecondOrderTimeInt::PostInitializeSolverSpecific(CSystem& computationalSystem, const SimulationSettings& simulationSettings)
 {
+	data.constantMassMatrixComputed = false; //systemMassMatrix has been resized and may contain initial mass matrix
+
 	if (IsVerbose(2))
 	{
 		if (simulationSettings.timeIntegration.generalizedAlpha.useNewmark)
@@ -283,8 +359,23 @@ void CSolverImplicitSecondOrderTimeInt::ComputeNewtonResidual(CSystem& computati
 
 	//now compute the new residual with updated system vectors:
 	STARTTIMER(timer.massMatrix);
-	data.systemMassMatrix->SetAllZero();
-	computationalSystem.ComputeMassMatrix(data.tempCompData, *(data.systemMassMatrix));
+	if (useMatrixFreeResidual)
+	{
+		//no global mass matrix needed; M*a is computed after ODE2RHS
+	}
+	else if (!useConstantMassMatrixCache)
+	{
+		data.systemMassMatrix->SetAllZero();
+		computationalSystem.ComputeMassMatrix(data.tempCompData, *(data.systemMassMatrix));
+	}
+	else if (!data.constantMassMatrixComputed || computationalSystem.GetSolverData().signalMassMatrixUpdate)
+	{
+		//only bodies with constant mass matrix; state-dependent bodies are added in ComputeMassMatrixTimesVector below
+		data.systemMassMatrix->SetAllZero();
+		computationalSystem.ComputeMassMatrix(data.tempCompData, *(data.systemMassMatrix), MassMatrixBodies::Constant);
+		data.constantMassMatrixComputed = true;
+		computationalSystem.GetSolverData().signalMassMatrixUpdate = false;
+	}
 	STOPTIMER(timer.massMatrix);
 
 	STARTTIMER(timer.ODE2RHS);
@@ -295,7 +386,23 @@ void CSolverImplicitSecondOrderTimeInt::ComputeNewtonResidual(CSystem& computati
 	STOPTIMER(timer.AERHS);
 
 	//systemMassMatrix.FinalizeMatrix(); //MultMatrixVector is faster? if directly applied to triplets ...
-	data.systemMassMatrix->MultMatrixVector(solutionODE2_tt, ode2Residual);
+	if (useMatrixFreeResidual)
+	{
+		STARTTIMER(timer.massMatrix);
+		ode2Residual.SetAll(0.);
+		computationalSystem.ComputeMassMatrixTimesVector(data.tempCompData, solutionODE2_tt, ode2Residual);
+		STOPTIMER(timer.massMatrix);
+	}
+	else
+	{
+		data.systemMassMatrix->MultMatrixVector(solutionODE2_tt, ode2Residual);
+	}
+	if (useConstantMassMatrixCache)
+	{
+		STARTTIMER(timer.massMatrix);
+		computationalSystem.ComputeMassMatrixTimesVector(data.tempCompData, solutionODE2_tt, ode2Residual, MassMatrixBodies::StateDependent);
+		STOPTIMER(timer.massMatrix);
+	}
 	//EXUmath::MultMatrixVector(systemMassMatrix, solutionODE2_tt, ode2Residual);
 	ode2Residual -= data.tempODE2; //systemResidual contains residual (linear: residual = M*a + K*u+D*v-F
 
@@ -362,25 +469,17 @@ void CSolverImplicitSecondOrderTimeInt::ComputeNewtonJacobian(CSystem& computati
 	data.systemJacobian->SetAllZero(); //entries are not set to zero inside jacobian computation!
 	//+++++++++++++++++++++++++++++
 	//Tangent stiffness
-	//compute jacobian (w.r.t. U ==> also add V); jacobianAE used as temporary matrix
+	//compute jacobian (w.r.t. U ==> also add V); added directly to system jacobian, scaled with factor
 	STARTTIMER(timer.jacobianODE2);
-	data.jacobianAE->SetNumberOfRowsAndColumns(data.nODE2, data.nODE2);
-	data.jacobianAE->SetAllZero(); //entries are not set to zero inside jacobian computation!
-	computationalSystem.NumericalJacobianODE2RHS(data.tempCompData, newton.numericalDifferentiation, data.tempODE2F0, data.tempODE2F1, *(data.jacobianAE)); //fills in part of jacobian
-
-	data.jacobianAE->MultiplyWithFactor(-EXUstd::Square(it.currentStepSize) * newmarkBeta * factJacAlgorithmic); //only ODE2 part; displacements (including those in contraints?) related to unknown accelerations by h^2*beta
-
-	data.systemJacobian->AddSubmatrix(*(data.jacobianAE), 0, 0);
+	computationalSystem.NumericalJacobianODE2RHS(data.tempCompData, newton.numericalDifferentiation, data.tempODE2F0, data.tempODE2F1, *(data.systemJacobian),
+		-EXUstd::Square(it.currentStepSize) * newmarkBeta * factJacAlgorithmic); //only ODE2 part; displacements (including those in contraints?) related to unknown accelerations by h^2*beta
 	STOPTIMER(timer.jacobianODE2);
 
 	//+++++++++++++++++++++++++++++
-	//'Damping' and gyroscopic terms; jacobianAE used as temporary matrix
+	//'Damping' and gyroscopic terms; added directly to system jacobian, scaled with factor
 	STARTTIMER(timer.jacobianODE2_t);
-	data.jacobianAE->SetAllZero(); //entries are not set to zero inside jacobian computation!
-	computationalSystem.NumericalJacobianODE2RHS_t(data.tempCompData, newton.numericalDifferentiation, data.tempODE2F0, data.tempODE2F1, *(data.jacobianAE)); //d(ODE2)/dq_t for damping terms
-	data.jacobianAE->MultiplyWithFactor(-it.currentStepSize * newmarkGamma * factJacAlgorithmic);
-	//jacobianAE *= -stepSize * newmarkGamma * factJacAlgorithmic;
-	data.systemJacobian->AddSubmatrix(*(data.jacobianAE), 0, 0);
+	computationalSystem.NumericalJacobianODE2RHS_t(data.tempCompData, newton.numericalDifferentiation, data.tempODE2F0, data.tempODE2F1, *(data.systemJacobian),
+		-it.currentStepSize * newmarkGamma * factJacAlgorithmic); //d(ODE2)/dq_t for damping terms
 	STOPTIMER(timer.jacobianODE2_t);
 
 	//+++++++++++++++++++++++++++++
@@ -399,7 +498,20 @@ void CSolverImplicitSecondOrderTimeInt::ComputeNewtonJacobian(CSystem& computati
 
 	STARTTIMER(timer.massMatrix);
 	//mass matrix is not updated for jacobian ...! //add a flag?
-	data.systemJacobian->AddSubmatrix(*(data.systemMassMatrix)); //systemMassMatrix used from initial step or from previous step; not scaled, because this is linear in unknown accelerations
+	if (useMatrixFreeResidual)
+	{
+		//global mass matrix is not available; bodies are added directly to jacobian
+		computationalSystem.ComputeMassMatrix(data.tempCompData, *(data.systemJacobian));
+	}
+	else
+	{
+		data.systemJacobian->AddSubmatrix(*(data.systemMassMatrix)); //systemMassMatrix used from initial step or from previous step; not scaled, because this is linear in unknown accelerations
+	}
+	if (useConstantMassMatrixCache && data.constantMassMatrixComputed)
+	{
+		//systemMassMatrix only contains constant part; state-dependent part is added in fixed body order (same sparsity pattern in every call)
+		computationalSystem.ComputeMassMatrix(data.tempCompData, *(data.systemJacobian), MassMatrixBodies::StateDependent);
+	}
 	STOPTIMER(timer.massMatrix);
 
 	computationalSystem.GetSolverData().signalJacobianUpdate = false; //as jacobian has been computed, no further update is necessary
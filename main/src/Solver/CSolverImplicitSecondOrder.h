@@ -34,6 +34,9 @@ public: //made public for access via pybind
 	Real alphaF;
 	Real spectralRadius;
 	Real factJacAlgorithmic;
+	bool useErrorControl;			//!< step size is controlled by local error estimate (automaticStepSize)
+	bool useConstantMassMatrixCache;//!< mass matrix of bodies with constant mass matrix is cached in systemMassMatrix (reuseConstantMassMatrix)
+	bool useMatrixFreeResidual;		//!< M*a in residual is computed per body without global mass matrix (matrixFreeResidual)
 
 	//bool useIndex2Constraints; ==> directly linked to simulationSettings
 public:
@@ -47,10 +50,13 @@ public:
 	//! reduce step size (1..normal, 2..severe problems); return true, if reduction was successful
 	virtual bool ReduceStepSize(CSystem& computationalSystem, const SimulationSettings& simulationSettings, Index severity) override;
 
-	//! increase step size if convergence is good
+	//! increase step size if convergence is good; in case of error control, step size is set in UpdateCurrentTime
 	virtual void IncreaseStepSize(CSystem& computationalSystem, const SimulationSettings& simulationSettings) override
 	{
-		it.currentStepSize = EXUstd::Minimum(it.maxStepSize, 2.*it.currentStepSize);
+		if (!useErrorControl)
+		{
+			it.currentStepSize = EXUstd::Minimum(it.maxStepSize, 2.*it.currentStepSize);
+		}
 	}
 
 	//! pre-initialize for solver specific tasks; called at beginning of InitializeSolver, right after Solver data reset
@@ -65,6 +71,12 @@ public:
 	//! update currentTime (and load factor); MUST be overwritten in special solver class
 	virtual void UpdateCurrentTime(CSystem& computationalSystem, const SimulationSettings& simulationSettings) override;
 
+	//! perform discontinuousIteration and, in case of error control, reject step if local error estimate is too large
+	virtual bool DiscontinuousIteration(CSystem& computationalSystem, const SimulationSettings& simulationSettings) override;
+
+	//! compute scaled RMS norm of local displacement error estimate of converged step; values <= 1 are accepted
+	Real ComputeLocalErrorNorm(CSystem& computationalSystem, const SimulationSettings& simulationSettings) const;
+
 	//! compute residual for Newton method (e.g. static or time step); store result in systemResidual
 	virtual void ComputeNewtonResidual(CSystem& computationalSystem, const SimulationSettings& simulationSettings) override;
 
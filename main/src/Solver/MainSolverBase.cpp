@@ -176,6 +176,7 @@ void MainSolverBase::SetSystemMassMatrix(const py::array_t<Real>& systemMassMatr
 	if (m.NumberOfColumns() != nSys || m.NumberOfRows() != nSys) { SysError("MainSolverBase::SetSystemMassMatrix(...): matrix has wrong size or MainSolverBase is not correctly initialized; call InitializeSolver() first"); }
 
 	GetCSolver().data.systemMassMatrix->SetMatrix(m);
+	GetCSolver().data.constantMassMatrixComputed = false;
 }
 
 //! set locally stored system residual
@@ -198,6 +199,7 @@ void MainSolverBase::ComputeMassMatrix(MainSystem& mainSystem/*, const Simulatio
 
 	GetCSolver().data.systemMassMatrix->SetAllZero();
 	mainSystem.cSystem->ComputeMassMatrix(GetCSolver().data.tempCompData, *(GetCSolver().data.systemMassMatrix));
+	GetCSolver().data.constantMassMatrixComputed = false; //systemMassMatrix contains full mass matrix
 	if (scalarFactor != 1.) { GetCSolver().data.systemMassMatrix->MultiplyWithFactor(scalarFactor); }
 }
 
@@ -70,11 +70,13 @@ namespace JacobianType {
 		AE_ODE2_t_function = 1 << 12,	//function available for derivative of AE (algebraic) equations with respect to ODE2_t (velocity) variables
 		AE_ODE1_function = 1 << 13,		//function available for derivative of AE (algebraic) equations with respect to ODE1 variables
 		AE_AE_function = 1 << 14,		//function available for derivative of AE (algebraic) equations with respect to AE variables
+		ODE2_ODE2_sparse = 1 << 15,		//ODE2 jacobians (ODE2_ODE2 and ODE2_ODE2_t) are added directly to the (sparse) system jacobian with AddJacobianODE2_ODE2(...)
 	};
 }
 
 class CObject;
 class CSystemData;
+class GeneralMatrix;
 
 //! this is a class belonging to CObject, which can be used to derive object-specific special functions, to be called under certain events (e.g. start of time step)
 class SpecialObjectFunctionsContainer
@@ -140,6 +142,9 @@ public:
 	//! Return true, if object will be computed (used to deactivate objects/contacts without computational overhead)
 	virtual bool IsActive() const { return true; }
 
+	//! Return true, if object has a computational (python) user function; such objects must not be computed in parallel threads (python GIL)
+	virtual bool HasUserFunction() const { return false; }
+
 	//! get number of computational coordinates (without data variables)
     virtual Index GetNumberOfCoordinates() const { return 2*GetODE2Size()+ GetODE1Size() + GetAlgebraicEquationsSize(); } //completely depends on nodes
     virtual Index GetODE1Size() const { return 0; } //completely depends on nodes
@@ -187,6 +192,9 @@ public:
     //! compute derivative of right-hand-side (RHS) w.r.t q of second order ordinary differential equations (ODE) [optional w.r.t. ODE2_t variables as well, if flag ODE2_ODE2_t_function set in GetAvailableJacobians()]; jacobian [and jacobianODE2_t] has dimension GetODE2Size() x GetODE2Size(); this is the local tangent stiffness matrix;
     virtual void ComputeJacobianODE2_ODE2(ResizableMatrix& jacobian, ResizableMatrix& jacobian_ODE2_t) const { CHECKandTHROWstring("ERROR: illegal call to CObject::ComputeODE2RHSJacobian"); }
 
+    //! add factor*(derivative of ODE2 LHS w.r.t. ODE2 coordinates [velocityLevel=false] or ODE2_t coordinates [velocityLevel=true]) directly to system jacobian, using the object's ltgODE2 indices; only called if flag ODE2_ODE2_sparse is set in GetAvailableJacobians(); used for large (sparse) objects to avoid dense local jacobians
+    virtual void AddJacobianODE2_ODE2(GeneralMatrix& jacobianGM, Real factor, const ArrayIndex& ltgODE2, bool velocityLevel) const { CHECKandTHROWstring("ERROR: illegal call to CObject::AddJacobianODE2_ODE2"); }
+
     //! compute derivative of algebraic equations w.r.t. ODE2 in jacobian [and w.r.t. ODE2_t coordinates in jacobian_t if flag ODE2_t_AE_function is set] [and w.r.t. AE coordinates if flag AE_AE_function is set in GetAvailableJacobians()]; jacobian[_t] has dimension GetAlgebraicEquationsSize() x (GetODE2Size() + GetODE1Size() [+GetAlgebraicEquationsSize()]); q are the system coordinates
     virtual void ComputeJacobianAE(ResizableMatrix& jacobian, ResizableMatrix& jacobian_t, ResizableMatrix& jacobian_AE) const { CHECKandTHROWstring("ERROR: illegal call to CObject::ComputeJacobianAE"); }
 
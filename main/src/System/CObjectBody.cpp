@@ -64,6 +64,50 @@ void CObjectBody::GetODE2LocalToGlobalCoordinates(ArrayIndex& ltg) const
 
 //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
+//! return true, if both markers are node markers of markerType (e.g. Marker::Position), but without orientation; the marker jacobians are then constant
+bool CObjectConnector::HasConstantMarkerJacobians(Marker::Type markerType) const
+{
+	for (Index markerNumber : GetMarkerNumbers())
+	{
+		Index type = (Index)cSystemData->GetCMarkers()[markerNumber]->GetType();
+		if (!(type & Marker::Node) || !(type & markerType) || (type & Marker::Orientation)) { return false; }
+	}
+	return true;
+}
+
+//! compute jacobian = [-J0, J1]^T * forceDerivative * [-J0, J1], in which J0 and J1 are the (constant) marker jacobians and forceDerivative is the derivative of the connector force w.r.t. the relative marker quantity (marker1 - marker0)
+void CObjectConnector::ComputeJacobianFromMarkerJacobians(const ResizableMatrix& jacobian0, const ResizableMatrix& jacobian1, const Matrix& forceDerivative, ResizableMatrix& jacobian)
+{
+	Index n0 = jacobian0.NumberOfColumns(); //special case: ground marker has (0,0) jacobian
+	Index n = n0 + jacobian1.NumberOfColumns();
+	Index nForce = forceDerivative.NumberOfRows();
+
+	jacobian.SetNumberOfRowsAndColumns(n, n);
+	jacobian.SetAll(0.);
+
+	//Jc = [-J0, J1]; jacobian(i,j) = sum_{a,b} Jc(a,i) * forceDerivative(a,b) * Jc(b,j)
+	auto Jc = [&](Index a, Index i) { return (i < n0) ? -jacobian0(a, i) : jacobian1(a, i - n0); };
+	for (Index i = 0; i < n; i++)
+	{
+		for (Index a = 0; a < nForce; a++)
+		{
+			Real Jai = Jc(a, i);
+			if (Jai == 0.) { continue; }
+			for (Index b = 0; b < nForce; b++)
+			{
+				Real value = Jai * forceDerivative(a, b);
+				if (value == 0.) { continue; }
+				for (Index j = 0; j < n; j++)
+				{
+					jacobian(i, j) += value * Jc(b, j);
+				}
+			}
+		}
+	}
+}
+
+//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
 //! get current algebraic coordinate with local index
 Real CObjectConstraint::GetCurrentAEcoordinate(Index localIndex) const
 { 
@@ -119,6 +119,9 @@ public:
 	//! compute object massmatrix to massMatrix ==> only possible for bodies!!!
 	virtual void ComputeMassMatrix(Matrix& massMatrix) const { CHECKandTHROWstring("ERROR: illegal call to CObject::ComputeMassMatrix"); }
 
+	//! return true, if mass matrix does not depend on coordinates and time; solvers may then reuse the (factorized) mass matrix
+	virtual bool HasConstantMassMatrix() const { return false; }
+
 }; //CObjectBody
 
 
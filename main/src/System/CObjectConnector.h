@@ -108,6 +108,14 @@ public:
 	//! function called after discontinuous iterations have been completed for one step (e.g. to finalize history variables and set initial values for next step)
 	virtual void PostDiscontinuousIterationStep() {};
 
+	//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	//helper functions for analytic jacobians of connectors
+	//! return true, if both markers are node markers of markerType (e.g. Marker::Position), but without orientation; the marker jacobians are then constant
+	bool HasConstantMarkerJacobians(Marker::Type markerType) const;
+
+	//! compute jacobian = [-J0, J1]^T * forceDerivative * [-J0, J1], in which J0 and J1 are the (constant) marker jacobians and forceDerivative is the derivative of the connector force w.r.t. the relative marker quantity (marker1 - marker0)
+	static void ComputeJacobianFromMarkerJacobians(const ResizableMatrix& jacobian0, const ResizableMatrix& jacobian1, const Matrix& forceDerivative, ResizableMatrix& jacobian);
+
 private:
 	//the following functions are not available for connectors, because they need the markerData structure
 	//they could be called via the base class, therefore exceptions are thrown!
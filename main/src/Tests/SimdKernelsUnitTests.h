@@ -0,0 +1,174 @@
+/** ***********************************************************************************************
+* @file			SimdKernelsUnitTests.h
+* @brief		This file contains unit tests and a microbenchmark for the SIMD kernels (EXUsimd) of vectors and matrices
+* @details		Details:
+                - SIMD kernels (if AVX2 is available) must give identical results to scalar fallback
+                - sizes are chosen to include remainders of the 4-item AVX2 blocks and small sizes below EXUsimd::minimumSize
+                - SimdKernelsBenchmark writes timings of SIMD and scalar kernels to the unit test output
+
+* @author		agent
+* @date			2026-10-16
+* @copyright	This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+*
+************************************************************************************************ */
+#ifndef SIMDKERNELSUNITTESTS__H
+#define SIMDKERNELSUNITTESTS__H
+
+#include <chrono>
+#include <cstdint> //uintptr_t
+
+//! fill vector with reproducible, non-trivial values
+inline void SimdTestFillVector(Vector& v, Real offset)
+{
+	for (Index i = 0; i < v.NumberOfItems(); i++) { v[i] = sin(0.37*(Real)i + offset) + 0.01*(Real)i; }
+}
+
+//! fill matrix with reproducible, non-trivial values
+inline void SimdTestFillMatrix(Matrix& m, Real offset)
+{
+	for (Index i = 0; i < m.NumberOfRows(); i++)
+	{
+		for (Index j = 0; j < m.NumberOfColumns(); j++) { m(i, j) = cos(0.11*(Real)(i * 7 + j) + offset); }
+	}
+}
+
+//! helper for SIMD tests: compute with SIMD kernels (if available) and with scalar fallback and restore EXUsimd::useSIMD
+class SimdTestSwitch
+{
+	bool storedUseSIMD;
+public:
+	SimdTestSwitch(bool useSIMD) { storedUseSIMD = EXUsimd::useSIMD; EXUsimd::useSIMD = useSIMD && EXUsimd::AVX2Available(); }
+	~SimdTestSwitch() { EXUsimd::useSIMD = storedUseSIMD; }
+};
+
+const lest::test simdKernels_specific_test[] =
+{
+	CASE("SIMD: aligned memory of Vector")
+	{
+#ifdef __cpp_aligned_new
+		for (Index n = 1; n < 40; n += 3)
+		{
+			Vector v(n);
+			EXPECT((uintptr_t)v.GetDataPointer() % EXUsimd::memoryAlignment == 0);
+		}
+#endif
+	},
+
+	CASE("SIMD: Vector operator+= equals scalar fallback")
+	{
+		for (Index n = 0; n < 45; n++)
+		{
+			Vector a(n), b(n), aScalar(n);
+			SimdTestFillVector(a, 0.1);
+			SimdTestFillVector(b, 0.7);
+			aScalar = a;
+			{ SimdTestSwitch s(true);  a += b; }
+			{ SimdTestSwitch s(false); aScalar += b; }
+			EXPECT(a == aScalar);
+		}
+	},
+
+	CASE("SIMD: GetL2NormSquared equals scalar fallback")
+	{
+		for (Index n = 0; n < 45; n++)
+		{
+			Vector a(n);
+			SimdTestFillVector(a, 0.3);
+			Real sequential = 0;
+			for (Real x : a) { sequential += x * x; }
+			Real normSIMD, normScalar;
+			{ SimdTestSwitch s(true);  normSIMD = a.GetL2NormSquared(); }
+			{ SimdTestSwitch s(false); normScalar = a.GetL2NormSquared(); }
+			EXPECT(normSIMD == normScalar);
+			EXPECT(fabs(normSIMD - sequential) <= 1e-14*sequential);
+			if (n < EXUsimd::minimumSize) { EXPECT(normSIMD == sequential); }
+		}
+	},
+
+	CASE("SIMD: MultMatrixVector and MultMatrixTransposedVector equal scalar fallback")
+	{
+		Index sizes[] = { 1, 3, 4, 5, 8, 15, 16, 17, 33 };
+		for (Index rows : sizes)
+		{
+			for (Index columns : sizes)
+			{
+				Matrix m(rows, columns);
+				SimdTestFillMatrix(m, 0.2);
+				Vector v(columns), vT(rows);
+				SimdTestFillVector(v, 0.5);
+				SimdTestFillVector(vT, 0.9);
+
+				Vector result, resultScalar, resultT, resultTScalar;
+				{
+					SimdTestSwitch s(true);
+					EXUmath::MultMatrixVector(m, v, result);
+					EXUmath::MultMatrixTransposedVector(m, vT, resultT);
+				}
+				{
+					SimdTestSwitch s(false);
+					EXUmath::MultMatrixVector(m, v, resultScalar);
+					EXUmath::MultMatrixTransposedVector(m, vT, resultTScalar);
+				}
+				EXPECT(result == resultScalar);
+				EXPECT(resultT == resultTScalar);
+				EXPECT(result == m * v);
+			}
+		}
+	},
+
+	CASE("SIMD: AddSubmatrix equals scalar fallback")
+	{
+		Matrix m(40, 45), sm(20, 23);
+		SimdTestFillMatrix(m, 0.4);
+		SimdTestFillMatrix(sm, 1.3);
+		Matrix mScalar = m;
+		{ SimdTestSwitch s(true);  m.AddSubmatrix(sm, 3, 17); }
+		{ SimdTestSwitch s(false); mScalar.AddSubmatrix(sm, 3, 17); }
+		EXPECT(m == mScalar);
+		EXPECT(m(3 + 19, 17 + 22) == mScalar(3 + 19, 17 + 22));
+	},
+};
+
+//! microbenchmark of SIMD kernels versus scalar fallback; writes timings (per operation) to os
+inline void SimdKernelsBenchmark(std::ostream& os)
+{
+	os << "\n******************\nSIMD kernels benchmark, AVX2 available = " << EXUsimd::AVX2Available() << "\n******************\n";
+	const Index n = 1000;
+	const Index repetitions = 2000;
+	Vector a(n), b(n), result;
+	Matrix m(n/4, n);
+	SimdTestFillVector(a, 0.1);
+	SimdTestFillVector(b, 0.2);
+	SimdTestFillMatrix(m, 0.3);
+	Vector bT(m.NumberOfRows());
+	SimdTestFillVector(bT, 0.4);
+
+	for (bool simd : {false, true})
+	{
+		SimdTestSwitch s(simd);
+		SimdTestFillVector(a, 0.1);
+		Real check = 0;
+		os << (simd ? "SIMD:  " : "scalar:");
+
+		auto t0 = std::chrono::steady_clock::now();
+		for (Index k = 0; k < repetitions; k++) { a += b; }
+		auto t1 = std::chrono::steady_clock::now();
+		for (Index k = 0; k < repetitions; k++) { check += a.GetL2Norm(); }
+		auto t2 = std::chrono::steady_clock::now();
+		for (Index k = 0; k < repetitions / 10; k++) { EXUmath::MultMatrixVector(m, a, result); }
+		auto t3 = std::chrono::steady_clock::now();
+		for (Index k = 0; k < repetitions / 10; k++) { EXUmath::MultMatrixTransposedVector(m, bT, result); }
+		auto t4 = std::chrono::steady_clock::now();
+		check += result[0];
+
+		auto us = [](std::chrono::steady_clock::time_point t0, std::chrono::steady_clock::time_point t1, Index count)
+			{ return std::chrono::duration<double, std::micro>(t1 - t0).count() / (double)count; };
+		os << " operator+= (n=" << n << "): " << us(t0, t1, repetitions) << "us"
+			<< ", GetL2Norm: " << us(t1, t2, repetitions) << "us"
+			<< ", MultMatrixVector (" << m.NumberOfRows() << "x" << n << "): " << us(t2, t3, repetitions / 10) << "us"
+			<< ", MultMatrixTransposedVector: " << us(t3, t4, repetitions / 10) << "us"
+			<< " (check=" << check << ")\n";
+	}
+}
+
+#endif
@@ -31,6 +31,7 @@ using namespace EXUstd;
 #include "Linalg/ResizableVector.h"
 
 #include "Linalg/Matrix.h"
+#include "Linalg/BasicLinalg.h" //for EXUmath::MultMatrixVector
 using namespace EXUmath;
 
 #define PerformUnitTests
@@ -39,6 +40,7 @@ using namespace EXUmath;
     #include "AllArrayUnitTests.h" 
     #include "AllMatrixUnitTests.h" 
     #include "TemplatedVectorArrayUnitTests.h" 
+    #include "SimdKernelsUnitTests.h" 
 #endif
 
 //enable memory leak checks by leak number {xxx}
@@ -299,6 +301,11 @@ int UnitTestBase::PerformVectorAndArrayTests(int flags)
 
     //matrix tests:
     failCounter += lest::run(matrix_specific_test, arglist_lest, stringStream);
+
+    //SIMD kernel tests and benchmark:
+    failCounter += lest::run(simdKernels_specific_test, arglist_lest, stringStream);
+
+    SimdKernelsBenchmark(stringStream);
 #endif
     if (failCounter) {
         stringStream << "\n\n\n***********************\n AT LEAST ONE TEST FAILED!\n***********************\n\n";
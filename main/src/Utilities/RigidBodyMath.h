@@ -347,6 +347,52 @@ namespace RigidBodyMath {
 			return mat;
 		}
 	}
+
+	//! sinc function sin(x)/x; Taylor series for small arguments
+	inline Real Sinc(Real x)
+	{
+		if (fabs(x) < 1e-4) { return 1. - x * x / 6.; }
+		return sin(x) / x;
+	}
+
+	//! compose rotation vector v0 with incremental (body-fixed) rotation vector Omega: R(v) = R(v0)*R(Omega);
+	//! computed via Euler parameters to avoid loss of accuracy of acos(...) for small angles; resulting rotation angle in [0, 2*pi]
+	inline Vector3D ComposeRotationVectors(const Vector3D& v0, const Vector3D& Omega)
+	{
+		Real phi0 = v0.GetL2Norm();
+		Real deltaPhi = Omega.GetL2Norm();
+
+		Real w0 = cos(0.5*phi0);
+		Vector3D e0 = (0.5*Sinc(0.5*phi0))*v0;
+		Real w1 = cos(0.5*deltaPhi);
+		Vector3D e1 = (0.5*Sinc(0.5*deltaPhi))*Omega;
+
+		Real w = w0 * w1 - e0 * e1;
+		Vector3D e = w0 * e1 + w1 * e0 + e0.CrossProduct(e1);
+
+		Real sinPhiHalf = e.GetL2Norm();
+		if (sinPhiHalf == 0.) { return Vector3D({ 0.,0.,0. }); }
+
+		return (2.*atan2(sinPhiHalf, w) / sinPhiHalf)*e;
+	}
+
+	//! inverse tangent operator of the exponential map of SO(3): T^{-1}(Omega) = I + 1/2*skew(Omega) + (1-phi/2*cot(phi/2))/phi^2*skew(Omega)^2, phi=|Omega|
+	inline Matrix3D TSO3Inv(const Vector3D& Omega)
+	{
+		Real phi = Omega.GetL2Norm();
+		if (phi == 0.) { return EXUmath::unitMatrix3D; }
+
+		Real gamma1; //1-x*cot(x), x=phi/2
+		Real x = 0.5*phi;
+		if (phi < 1e-1) { gamma1 = x * x / 3. + pow(x, 4) / 45. + 2.*pow(x, 6) / 945. + pow(x, 8) / 4725.; } //series avoids cancellation
+		else { gamma1 = 1. - x / tan(x); }
+
+		Matrix3D mat(EXUmath::unitMatrix3D);
+		Matrix3D OmegaTilde(Vector2SkewMatrix(Omega));
+		mat += 0.5*OmegaTilde;
+		mat += (gamma1 / (phi*phi))*OmegaTilde*OmegaTilde;
+		return mat;
+	}
 	//********************************************************************************
 	//simple functions for ROTATION MATRICES
 
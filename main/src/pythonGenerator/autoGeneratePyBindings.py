@@ -101,6 +101,11 @@ sLenum += DefLatexStartClass(sectionName = pyClass,
 [s1,sL1] = AddEnumValue(pyClass, '_None', 'no value; used, e.g., if no solver is selected'); s+=s1; sLenum+=sL1
 [s1,sL1] = AddEnumValue(pyClass, 'EXUdense', 'use dense matrices and according solvers for densly populated matrices (usually the CPU time grows cubically with the number of unknowns)'); s+=s1; sLenum+=sL1
 [s1,sL1] = AddEnumValue(pyClass, 'EigenSparse', 'use sparse matrices and according solvers; additional overhead for very small systems; specifically, memory allocation is performed during a factorization process'); s+=s1; sLenum+=sL1
+[s1,sL1] = AddEnumValue(pyClass, 'EigenSparseSymmetric', 'use sparse matrices and Eigen SparseLU in symmetric mode, preferring diagonal pivots; for symmetric or symmetric indefinite (saddle point) systems'); s+=s1; sLenum+=sL1
+[s1,sL1] = AddEnumValue(pyClass, 'EigenSparseLUAMD', 'use sparse matrices and Eigen SparseLU with approximate minimum degree ordering; only available if compiled with USE_EIGEN_LGPL_SOLVERS'); s+=s1; sLenum+=sL1
+[s1,sL1] = AddEnumValue(pyClass, 'EigenSparseLDLT', 'use sparse matrices and Eigen SimplicialLDLT for symmetric matrices (no pivoting, lower triangular part used; symmetry is checked in every factorization); only available if compiled with USE_EIGEN_LGPL_SOLVERS'); s+=s1; sLenum+=sL1
+[s1,sL1] = AddEnumValue(pyClass, 'EigenSparseLLT', 'use sparse matrices and Eigen SimplicialLLT for symmetric positive or negative definite matrices (lower triangular part used; symmetry is checked in every factorization); only available if compiled with USE_EIGEN_LGPL_SOLVERS'); s+=s1; sLenum+=sL1
+[s1,sL1] = AddEnumValue(pyClass, 'EigenSparseIterative', 'use sparse matrices and iterative Eigen BiCGSTAB solver with incomplete LU (ILUT) preconditioner; the preconditioner is only recomputed at Jacobian updates and reused during modified Newton iterations; see NewtonSettings.linearSolverTolerance'); s+=s1; sLenum+=sL1
 
 s +=	'		.export_values();\n\n'
 sLenum += DefLatexFinishClass()
@@ -222,7 +227,7 @@ sL+=sL1
                             			PyError(HString("SystemContainer::TimeIntegrationSolve: invalid solverName '")+solverName+"'; options are: RungeKutta1 or GeneralizedAlpha");
                             		}""", 
                                 argList=['mainSystem','solverName','simulationSettings'],
-                                description="Call time integration solver for given system with solverName ('RungeKutta1'...explicit solver, 'GeneralizedAlpha'...implicit solver); use simulationSettings to individually configure the solver",
+                                description="Call time integration solver for given system with solverName ('RungeKutta1'...explicit solver, 'RungeKutta4'...explicit 4th order Runge-Kutta, 'DormandPrince45'...explicit Runge-Kutta with step size control, 'GeneralizedAlpha'...implicit solver); use simulationSettings to individually configure the solver",
                                 example = "simSettings = exu.SimulationSettings()\\\\simSettings.timeIntegration.numberOfSteps = 1000\\\\simSettings.timeIntegration.endTime = 2\\\\simSettings.timeIntegration.verboseMode = 1\\\\SC.TimeIntegrationSolve(mbs, 'GeneralizedAlpha', simSettings)",
                                 isLambdaFunction = True
                                 ); sL+=sL1
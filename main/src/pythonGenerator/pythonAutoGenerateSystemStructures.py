@@ -27,6 +27,10 @@ convertToDict = {'ResizableVector':'Vector', 'StdArray33F':'Matrix', 'NumpyVecto
 #convert special size parameters:
 sizeParameterConvert = {'3x3':'9', '2x2':'4'} 
 
+#file streams and file buffers (solver internal) are not printable and get no pybind access functions
+def IsFileType(typeStr):
+    return typeStr.find('std::ofstream') != -1 or typeStr.find('std::vector<char>') != -1
+
 #************************************************
 #create autogenerated .h  file for list of parameters
 def WriteFile(parseInfo, parameterList, typeConversion):
@@ -283,7 +287,7 @@ def WriteFile(parseInfo, parameterList, typeConversion):
                 s+='Get' + functionStr + '() { return ' + paramStr + '; }\n'
 
             typeCastStr = TypeConversion(parameter['type'], typeCasts)
-            if ((typeCastStr.find('std::vector') != -1 or typeCastStr.find('std::array') != -1) and typeCastStr.find('std::ofstream') == -1) or (parameter['lineType'].find('L') == -1  and parameter['cplusplusName'].find('.') != -1): #then it must get a set/get function!
+            if ((typeCastStr.find('std::vector') != -1 or typeCastStr.find('std::array') != -1) and not IsFileType(typeCastStr)) or (parameter['lineType'].find('L') == -1  and parameter['cplusplusName'].find('.') != -1): #then it must get a set/get function!
                 accessWritten = True
                 castStr = '(' + typeCastStr + ')'
                 linkedClassStr = ''
@@ -409,7 +413,7 @@ def WriteFile(parseInfo, parameterList, typeConversion):
         
     #output each parameter
     for parameter in parameterList:
-        if (parameter['lineType'].find('V') != -1) and (parameter['lineType'].find('L') == -1) and (parameter['type']!='TemporaryComputationData') and (parameter['type'].find('std::ofstream')==-1) and (parameter['type'].find('userFunction')==-1): #only if it is a member variable; some types not printable
+        if (parameter['lineType'].find('V') != -1) and (parameter['lineType'].find('L') == -1) and (parameter['type']!='TemporaryComputationData') and not IsFileType(parameter['type']) and (parameter['type'].find('userFunction')==-1): #only if it is a member variable; some types not printable
             paramStr = parameter['cplusplusName']
             typeStr = TypeConversion(parameter['type'], typeConversion)
             refChar = ''
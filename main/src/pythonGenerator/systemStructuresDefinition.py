@@ -57,6 +57,12 @@ V,  coordinatesSolutionFileName,, 	  , FileName,                "coordinatesSolu
 V,  solverInformationFileName,  , 	  , FileName,                "solverInformation.txt",   ,P		, "filename and (relative) path of text file showing detailed information during solving; detail level according to yourSolver.verboseModeFile; if solutionSettings.appendToFile is true, the information is appended in every solution step; directory will be created if it does not exist"
 V,  solutionInformation,	     ,    , String,                "",       ,      P	  , "special information added to header of solution file (e.g. parameters and settings, modes, ...)"
 V,  outputPrecision,            , 	  , Index,                 10,       ,       P		, "precision for floating point numbers written to solution and sensor files"
+V,  binarySolutionFile,         , 	  , bool,                  false,    ,       P		, "flag (true/false); if true, solution and sensor files are written in binary format: a self-describing header (see LoadBinaryFile(...) in exudyn.utilities) followed by rows of raw little-endian Real values; the data section can be memory-mapped; outputPrecision and writeFileFooter have no effect in binary mode; the binary header is always written (writeFileHeader only controls the embedded text); with appendToFile, rows are appended to an existing binary file without a second header, if the existing header has the same layout (otherwise an error is raised and the file is not written)"
+V,  outputBufferSize,           , 	  , Index,                 65536,    ,       P		, "size of write buffer in bytes, which is used for the solution file and for every sensor file; larger buffers reduce the number of file system calls for large systems; values below 4096 are increased to 4096"
+V,  writeAsynchronously,        , 	  , bool,                  false,    ,       P		, "flag (true/false); if true, solution and sensor files are written by a background writer thread: the solver only copies the exported values into a ring buffer and continues, while formatting and file output are done in parallel; time of writer thread is shown as writeSolutionAsync in timer statistics"
+V,  asyncBufferSize,            , 	  , Index,                 16777216, ,       P		, "size of ring buffer in bytes for asynchronous output (writeAsynchronously); it is enlarged automatically to hold at least two solution rows"
+V,  asyncBlockIfBufferFull,     , 	  , bool,                  true,     ,       P		, "flag (true/false) for asynchronous output; if true, the solver waits until the writer thread provides space in a full ring buffer (no data is lost); if false, rows are dropped if the ring buffer is full and the number of dropped rows is reported at the end of simulation"
+V,  asyncFlushOnFinalize,       , 	  , bool,                  true,     ,       P		, "flag (true/false) for asynchronous output; if true, the solver waits at the end of simulation until all buffered rows are written; if false, rows which are not yet written at the end of simulation are discarded (e.g. to stop quickly)"
 V,  recordImagesInterval,       , 	  , Real,                  -1.,      ,       P    ,  "record frames (images) during solving: amount of time to wait until next image (frame) is recorded; set recordImages = -1. if no images shall be recorded; set, e.g., recordImages = 0.01 to record an image every 10 milliseconds (requires that the time steps / load steps are sufficiently small!); for file names, etc., see VisualizationSettings.exportImages"
 #
 writeFile=SimulationSettings.h
@@ -71,6 +77,7 @@ V,  relativeEpsilon,      ,  		     ,      UReal, 			   1e-7,        ,      P	 ,
 V,  minimumCoordinateSize,,  		     ,      UReal, 			   1e-2,        ,      P	 , "minimum size of coordinates in relative differentiation parameter"
 V,  doSystemWideDifferentiation,,    ,      bool, 			   false,          ,      P    , "true: system wide differentiation (e.g. all ODE2 equations w.r.t. all ODE2 coordinates); false: only local (object) differentiation"
 V,  addReferenceCoordinatesToEpsilon,, ,    bool, 			   false,          ,      P    , "true: for the size estimation of the differentiation parameter, the reference coordinate $q^{Ref}_i$ is added to ODE2 coordinates --> see; false: only the current coordinate is used for size estimation of the differentiation parameter"
+V,  compressedSystemWideDifferentiation,, , bool, 			   false,          ,      P    , "true: system wide differentiation (doSystemWideDifferentiation) perturbs all coordinates at once which do not share an object or node (column coloring, Curtis-Powell-Reed); needs a few ODE2RHS evaluations instead of one per coordinate for large systems with local coupling; only valid if forces of objects and loads only depend on coordinates of the object or load (not for user functions using coordinates of other items)"
 #
 writeFile=SimulationSettings.h
 
@@ -96,6 +103,8 @@ V,  maxIterations,	           ,  		 ,     Index, 					25,    ,  P		, "maximum nu
 V,  maxModifiedNewtonIterations,,     ,     Index, 					8,     , P		, "maximum number of iterations for modified Newton (without Jacobian update); after that number of iterations, the modified Newton method gets a jacobian update and is further iterated"
 V,  maxModifiedNewtonRestartIterations, , , Index, 					7,     , P		, "maximum number of iterations for modified Newton after aJacobian update; after that number of iterations, the full Newton method is started for this step"
 V,  maximumSolutionNorm,	  ,  		 ,       UReal, 					1e38,  ,  P		, "this is the maximum allowed value for solutionU.L2NormSquared() which is the square of the square norm (value=$u_1^2$+$u_2^2$+...), and solutionV/A...; if the norm of solution vectors are larger, Newton method is stopped; the default value is chosen such that it would still work for single precision numbers (float)"
+V,  linearSolverTolerance,	  ,  		 ,       UReal, 					1e-10, ,  P		, "relative residual tolerance ($|\mathbf{A} \Delta \mathbf{q} - \mathbf{r}|/|\mathbf{r}|$) for iterative linear solver (linearSolverType = EigenSparseIterative) used to compute Newton increments; 0 ... use machine precision"
+V,  linearSolverMaxIterations,,  		 ,       Index, 					0,     ,  P		, "maximum number of iterations of iterative linear solver (linearSolverType = EigenSparseIterative) per Newton increment; 0 ... use 2 times number of unknowns; if the tolerance is not reached, the Newton iteration is repeated with updated Jacobian (and preconditioner); if the tolerance is still not reached, the linear solver fails, which leads to step reduction (if possible) or stops the solver"
 #discontinuous iteration -> does not really belong to Newton, but is a kind of extension
 V,  maxDiscontinuousIterations,	,  	 ,     Index, 					5,     , P		, "maximum number of discontinuous (post Newton) iterations"
 V,  ignoreMaxDiscontinuousIterations,	,,     bool, 					true,     , P		, "continue solver if maximum number of discontinuous (post Newton) iterations is reached (ignore tolerance)"
@@ -117,6 +126,19 @@ V,  useIndex2Constraints,	 ,  		      ,     bool, 				  false,   , P		, "set use
 V,  useNewmark,	            ,  		      ,     bool, 				  false,   , P		, "if true, use Newmark method with beta and gamma instead of generalized-Alpha"
 V,  spectralRadius,	       ,  		      ,     UReal, 				0.9,    , P		, "spectral radius for Generalized-alpha solver; set this value to 1 for no damping or to 0 < spectralRadius < 1 for damping of high-frequency dynamics; for position-level constraints (index 3), spectralRadius must be < 1"
 V,  computeInitialAccelerations,	,     ,     bool, 				  true,    , P		, "true: compute initial accelerations from system EOM in acceleration form; NOTE that initial accelerations that are following from user functions in constraints are not considered for now! false: use zero accelerations"
+V,  reuseConstantMassMatrix,	,     ,     bool, 				  true,    , P		, "true: the mass matrix of bodies with constant mass matrix (e.g. mass points, ANCF elements, rigid bodies with Lie group nodes and zero center of mass) is computed only once and reused in all steps; only state-dependent mass matrices (e.g. rigid bodies with Euler parameters, FFRF) are recomputed in every iteration; changing object parameters with SetObjectParameter(...) during simulation (e.g. in preStepUserFunction) signals the solver to recompute the cached mass matrix"
+V,  matrixFreeResidual,	   ,     ,     bool, 				  false,   , P		, "true: the term M*a in the residual is evaluated body by body (local mass matrix times local accelerations, added via local-to-global coordinate lists) without assembling the global mass matrix; the mass matrix is then only assembled into the system Jacobian; advantageous for large (sparse) systems with many residual evaluations per Jacobian update (e.g. modified Newton); overrides reuseConstantMassMatrix for the residual"
+#
+writeFile=SimulationSettings.h
+
+#++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+class = ExplicitIntegrationSettings
+appendToFile=True
+writePybindIncludes = True
+classDescription = "Settings for explicit Runge-Kutta time integration methods (RungeKutta4, DormandPrince45)."
+#V|F, pythonName, 		cplusplusName,   size, type,					defaultValue,args, cFlags, parameterDescription
+V,  reuseConstantMassMatrix,	,     ,     bool, 				  true,    , P		, "true: if all bodies have constant mass matrices, the mass matrix is only factorized once at the beginning of the simulation and after changes of object parameters with SetObjectParameter(...); false: mass matrix is computed and factorized at every stage"
+V,  computeEndOfStepAccelerations,	,     ,     bool, 				  true,    , P		, "true: accelerations are evaluated at the end of every step (for output and sensors; causes one additional RHS evaluation per step for RungeKutta4); false: accelerations of the last stage are kept"
 #
 writeFile=SimulationSettings.h
 
@@ -132,10 +154,14 @@ V,  endTime,				    , 	 	, UReal, 			        1	, 		,  P, "end time of time integ
 V,  numberOfSteps,		    , 	 	, UInt, 			        100	, 	,	 P, "number of steps in time integration; stepsize is computed from (endTime-startTime)/numberOfSteps"
 V,  adaptiveStep,			 , 	 	, bool, 			        true,   ,  P, "true: use step reduction if step fails; false: constant step size"
 V,  minimumStepSize,	    ,  		, UReal, 		           1e-8,   ,  P, "lower limit of time step size, before integrator stops"
+V,  automaticStepSize,	    ,  		, bool, 		           false,  ,  P, "true: generalized-alpha / Newmark step size is controlled by a local error estimate within minimumStepSize and the maximum step size (endTime-startTime)/numberOfSteps; requires adaptiveStep=True; DormandPrince45 always uses its embedded error estimate if adaptiveStep=True"
+V,  absoluteTolerance,	    ,  		, UReal, 		           1e-8,   ,  P, "absolute tolerance for step size control of time integration methods with error estimator (DormandPrince45 or automaticStepSize=True); only used if adaptiveStep=True"
+V,  relativeTolerance,	    ,  		, UReal, 		           1e-8,   ,  P, "relative tolerance for step size control of time integration methods with error estimator (DormandPrince45 or automaticStepSize=True); only used if adaptiveStep=True"
 #
 V,  verboseMode,	      ,  	  , Index, 			        0  ,    ,   P, "0 ... no output, 1 ... show short step information every 2 seconds (error), 2 ... show every step information, 3 ... show also solution vector, 4 ... show also mass matrix and jacobian (implicit methods), 5 ... show also Jacobian inverse (implicit methods)"
 V,  verboseModeFile,	    ,  	  , Index, 			        0  ,    ,   P, "same behaviour as verboseMode, but outputs all solver information to file"
 V,  generalizedAlpha,    ,     , GeneralizedAlphaSettings,  ,   ,   PS, "parameters for generalized-alpha, implicit trapezoidal rule or Newmark (options only apply for these methods)"
+V,  explicitIntegration, ,     , ExplicitIntegrationSettings,  ,   ,   PS, "parameters for explicit Runge-Kutta methods (options only apply for these methods)"
 V,  preStepPyExecute,		 , 	 	, String, 			        ""	, 		,   P, "DEPRECATED, use preStepFunction in simulation settings; Python code to be executed prior to every step and after last step, e.g. for postprocessing"
 #
 writeFile=SimulationSettings.h
@@ -175,13 +201,14 @@ classDescription = "General Settings for simulation; according settings for solu
 V,  timeIntegration,                ,  		        , TimeIntegrationSettings, 	  , , PS		, "time integration parameters"
 V,  solutionSettings,				     , 	 	        , SolutionSettings,  	        , , PS   , "settings for solution files"
 V,  staticSolver,				        , 	 	        , StaticSolverSettings,  		  , , PS	   , "static solver parameters"
-V,  linearSolverType,				     , 	 	        , LinearSolverType,    "LinearSolverType::EXUdense", , P	   , "selection of numerical linear solver: exu.LinearSolverType.EXUdense (dense matrix inverse), exu.LinearSolverType.EigenSparse (sparse matrix LU-factorization), ... (enumeration type)"
+V,  linearSolverType,				     , 	 	        , LinearSolverType,    "LinearSolverType::EXUdense", , P	   , "selection of numerical linear solver: exu.LinearSolverType.EXUdense (dense matrix inverse), exu.LinearSolverType.EigenSparse (sparse matrix LU-factorization), exu.LinearSolverType.EigenSparseSymmetric (sparse LU-factorization with preferred diagonal pivots for symmetric or saddle point matrices), exu.LinearSolverType.EigenSparseLUAMD/EigenSparseLDLT/EigenSparseLLT (AMD ordered LU, symmetric LDLT and Cholesky factorization; only available if compiled with USE_EIGEN_LGPL_SOLVERS), exu.LinearSolverType.EigenSparseIterative (BiCGSTAB with ILUT preconditioner, see newton.linearSolverTolerance), ... (enumeration type)"
 V,  cleanUpMemory,                  , 	           , bool,                false   , , P		, "true: solvers will free memory at exit (recommended for large systems); false: keep allocated memory for repeated computations to increase performance"
 V,  displayStatistics,              , 	           , bool,                false   , , P		, "display general computation information at end of time step (steps, iterations, function calls, step rejections, ..."
 V,  displayComputationTime,         , 	           , bool,                false   , , P		, "display computation time statistics at end of solving"
 V,  pauseAfterEachStep,             ,  		        , bool, 	             false   , , P		, "pause after every time step or static load step(user press SPACE)"
 V,  outputPrecision,                , 	           , Index,               6       , , P		, "precision for floating point numbers written to console; e.g. values written by solver"
-V,  numberOfThreads,                , 	           , Index,               1       , , P		, "number of threads used for parallel computation (1 == scalar processing); not yet implemented (status: Nov 2019)"
+V,  numberOfThreads,                , 	           , Index,               1       , , P		, "number of threads used for parallel computation (1 == scalar processing); used for multithreaded computation of object ODE2 right-hand-side (results are identical to serial computation; objects with python user functions are computed serially) and for linear solvers; requires compilation with OpenMP"
+V,  batchedObjectComputation,       , 	           , bool,                true    , , P		, "true: ObjectConnectorSpringDamper (without user function) between NodePoint/NodePoint2D nodes, MassPoint/MassPoint2D or ObjectGround markers (MarkerNodePosition, MarkerBodyPosition) are computed in batched loops over contiguous arrays in the ODE2 right-hand-side, without marker jacobians, and MassPoint/MassPoint2D objects are skipped; results are identical to per-object computation; false: all objects are computed per object"
 #
 writeFile=SimulationSettings.h
 
@@ -482,6 +509,8 @@ classDescription = "Structure for timing in solver. Each Real variable is used t
 V,      useTimer,                   , 	             ,     bool,         true,                   ,   P,    "flag to decide, whether the timer is used (true) or not"
 V,      total,                      , 	             ,     Real,         0.,                     ,   P,    "total time measured between start and end of computation (static/dynamics)"
 V,      factorization,              , 	             ,     Real,         0.,                     ,   P,    "solve or inverse"
+V,      factorizationSymbolic,      , 	             ,     Real,         0.,                     ,   P,    "part of factorization spent by the sparse solver backend for symbolic factorization (ordering, elimination tree); included in factorization, not counted in sum"
+V,      linearSolverType,           , 	             ,     LinearSolverType, "LinearSolverType::_None", ,   P,    "linear solver (backend) used for factorization; shown with factorization time in statistics"
 V,      newtonIncrement,            , 	             ,     Real,         0.,                     ,   P,    "Jac$^{-1}$ * RHS; backsubstitution"
 V,      integrationFormula,         , 	             ,     Real,         0.,                     ,   P,    "time spent for evaluation of integration formulas"
 V,      ODE2RHS,                    , 	             ,     Real,         0.,                     ,   P,    "time for residual evaluation of ODE2 right-hand-side"
@@ -494,6 +523,7 @@ V,      massMatrix,                 , 	             ,     Real,         0.,
 V,      reactionForces,             , 	             ,     Real,         0.,                     ,   P,    "CqT * lambda"
 V,      postNewton,                 , 	             ,     Real,         0.,                     ,   P,    "post newton step"
 V,      writeSolution,              , 	             ,     Real,         0.,                     ,   P,    "time for writing solution"
+V,      writeSolutionAsync,         , 	             ,     Real,         0.,                     ,   P,    "time spent by background writer thread for asynchronous output (solutionSettings.writeAsynchronously); runs in parallel and is not counted in sum"
 V,      overhead,                   , 	             ,     Real,         0.,                     ,   P,    "overhead, such as initialization, copying and some matrix-vector multiplication"
 V,      python,                     , 	             ,     Real,         0.,                     ,   P,    "time spent for python functions"
 V,      visualization,              , 	             ,     Real,         0.,                     ,   P,    "time spent for visualization in computation thread"
@@ -521,6 +551,7 @@ V,      startAE,                    , 	             ,     Index,        0,
 #
 V,      systemJacobian,             , 	             ,     GeneralMatrix*, nullptr,             ,    ,    "link to dense or sparse system jacobian"
 V,      systemMassMatrix,           , 	             ,     GeneralMatrix*, nullptr,             ,    ,    "link to dense or sparse system matrix"
+V,      constantMassMatrixComputed, , 	             ,     bool,         false,                  ,   P,    "true: systemMassMatrix only contains the (cached) mass matrix of bodies with constant mass matrix; must be set false if systemMassMatrix is recomputed or resized"
 V,      jacobianAE,                 , 	             ,     GeneralMatrix*, nullptr,             ,    ,    "link to dense or sparse algebraic equations jacobian"
 #
 V,      systemResidual,             , 	             ,     ResizableVector, ,                    ,   P,    "system residual vector (vectors will be linked to this vector!)"
@@ -541,7 +572,7 @@ Vp,     systemJacobianDense,        , 	             ,     GeneralMatrixEXUdense,
 Vp,     systemMassMatrixDense,      , 	             ,     GeneralMatrixEXUdense,,               ,    ,    "dense mass matrix"
 Vp,     jacobianAEdense,            , 	             ,     GeneralMatrixEXUdense,,               ,    ,    "dense AE jacobian"
 #SPARSE:
-Vp,     systemJacobianSparse,       , 	             ,     GeneralMatrixEigenSparse,,            ,    ,    "sparse system jacobian"
+Vp,     systemJacobianSparse,       , 	             ,     GeneralMatrixEigenSparseFixedPattern,,            ,    ,    "sparse system jacobian; keeps sparsity pattern and refills values in place"
 Vp,     systemMassMatrixSparse,     , 	             ,     GeneralMatrixEigenSparse,,            ,    ,    "sparse mass matrix"
 Vp,     jacobianAEsparse,           , 	             ,     GeneralMatrixEigenSparse,,            ,    ,    "sparse AE jacobian"
 #
@@ -549,6 +580,7 @@ Vp,     jacobianAEsparse,           , 	             ,     GeneralMatrixEigenSpar
 F,      CleanUpMemory,              ,                ,     void,         ,                       ,    DP,  "if desired, temporary data is cleaned up to safe memory"
 F,      SetLinearSolverType,        ,                ,     void,         ,                       "LinearSolverType linearSolverType",   DP,  "set linear solver type and matrix version: links system matrices to according dense/sparse versions"
 F,      GetLinearSolverType,        ,                ,     LinearSolverType, "return linearSolverType;", ,   CPV,  "return current linear solver type (dense/sparse)"
+F,      SetIterativeSolverSettings, ,                ,     void,         "systemJacobianSparse.SetIterativeSolverSettings(tolerance, maxIterations);", "Real tolerance, Index maxIterations",   ,  "set relative tolerance and maximum number of iterations for iterative linear solver (EigenSparseIterative); only affects system jacobian"
 #
 writeFile=CSolverStructures.h
 
@@ -562,6 +594,7 @@ classDescription = "Solver internal structure for counters, steps, step size, ti
 V,      maxStepSize,                , 	             ,     Real,         0.,                     ,   P,    "constant or maximum stepSize"
 V,      minStepSize,                , 	             ,     Real,         0.,                     ,   P,    "minimum stepSize for static/dynamic solver; only used, if adaptive step is activated"
 V,      currentStepSize,            , 	             ,     Real,         0.,                     ,   P,    "stepSize of current step"
+V,      recommendedStepSize,        , 	             ,     Real,         0.,                     ,   P,    "step size proposed by the error estimator of the time integration method for the next step; only used by methods with error control"
 V,      numberOfSteps,              , 	             ,     Index,        0,                      ,   P,    "number of time steps (if fixed size); $n$"
 V,      currentStepIndex,           , 	             ,     Index,        0,                      ,   P,    "current step index; $i$"
 #
@@ -577,7 +610,19 @@ V,      newtonSteps,                , 	             ,     Index,        0,
 V,      newtonStepsCount,           , 	             ,     Index,        0,                      ,   P,    "count total Newton steps"
 V,      newtonJacobiCount,          , 	             ,     Index,        0,                      ,   P,    "count total Newton jacobian computations"
 V,      rejectedModifiedNewtonSteps,, 	             ,     Index,        0,                      ,   P,    "count the number of rejected modified Newton steps (switch to full Newton)"
+V,      linearSolverIterationsCount,, 	             ,     Index,        0,                      ,   P,    "count total number of iterations of iterative linear solver (EigenSparseIterative)"
+V,      linearSolverFailedCount,    , 	             ,     Index,        0,                      ,   P,    "count linear solves, which did not reach the tolerance (EigenSparseIterative)"
 V,      discontinuousIterationsCount,, 	             ,     Index,        0,                      ,   P,    "count total number of discontinuous iterations (min. 1 per step)"
+V,      rejectedSteps,              , 	             ,     Index,        0,                      ,   P,    "count total number of rejected steps (step size reduction due to failed Newton iterations or local error estimate)"
+V,      smallestStepSize,           , 	             ,     Real,         0.,                     ,   P,    "smallest accepted step size"
+V,      largestStepSize,            , 	             ,     Real,         0.,                     ,   P,    "largest accepted step size"
+V,      allocationsCount,           , 	             ,     Index,        0,                      ,   P,    "count total number of memory allocations of arrays, vectors and matrices in steps after the first step (which allocates solver workspace); only counted if Exudyn is compiled with runtime checks (__EXUDYN_RUNTIME_CHECKS__), otherwise 0"
+V,      maxStepAllocations,         , 	             ,     Index,        0,                      ,   P,    "maximum number of memory allocations of arrays, vectors and matrices in one step after the first step; 0 means that steps are allocation-free; see allocationsCount"
+V,      allocationsResidual,        , 	             ,     Index,        0,                      ,   P,    "part of allocationsCount in residual computation (Newton update and residual, explicit right-hand-side)"
+V,      allocationsJacobian,        , 	             ,     Index,        0,                      ,   P,    "part of allocationsCount in computation of jacobian and mass matrix"
+V,      allocationsFactorization,   , 	             ,     Index,        0,                      ,   P,    "part of allocationsCount in factorization and linear solves (Newton increment)"
+V,      allocationsOutput,          , 	             ,     Index,        0,                      ,   P,    "part of allocationsCount in console and solution file output and visualization update"
+V,      allocationsSensors,         , 	             ,     Index,        0,                      ,   P,    "part of allocationsCount in evaluation and output of sensors"
 #
 F,      ToString,                   ,                ,     String,       ,                       ,   CDPV,  "convert iteration statistics to string; used for displayStatistics option"
 #
@@ -591,7 +636,7 @@ classDescription = "Solver internal structure for convergence information: resid
 #V|F,   pythonName, 		          cplusplusName,      size, type,	      defaultValue,            args,           cFlags, parameterDescription
 V,      stepReductionFailed,        , 	             ,     bool,         false,                       ,   P,    "true, if iterations over time/static steps failed (finally, cannot be recovered)"
 V,      discontinuousIterationsFailed,,              ,     bool,         false,                       ,   P,    "true, if discontinuous iterations failed (may be recovered if adaptive step is active)"
-V,      linearSolverFailed,         , 	             ,     bool,         false,                       ,   P,    "true, if linear solver failed to factorize"
+V,      linearSolverFailed,         , 	             ,     bool,         false,                       ,   P,    "true, if linear solver failed to factorize or iterative linear solver did not converge with updated Jacobian"
 V,      newtonConverged,            , 	             ,     bool,         false,                       ,   P,    "true, if Newton has (finally) converged"
 V,      newtonSolutionDiverged,     , 	             ,     bool,         false,                       ,   P,    "true, if Newton diverged (may be recovered)"
 V,      jacobianUpdateRequested,    , 	             ,     bool,         true,                        ,   P,    "true, if a jacobian update is requested in modified Newton (determined in previous step)"
@@ -639,6 +684,8 @@ classDescription = "Solver internal structure for output files. This structure i
 V,      solutionFile,               , 	             ,     std::ofstream,,                       ,    ,    "solution file with coordinate data"
 V,      solverFile,                 , 	             ,     std::ofstream,,                       ,    ,    "file with detailed solver information"
 V,      sensorFileList,             , 	             ,     std::vector<std::ofstream*>,,         ,    ,    "files for sensor output; the ofstream list corresponds exactly to the sensors in the computationalSystem (i.e., sensorFileList[0] is the ofstream for sensor 0, etc.); file lists need to be closed and deleted at end of simulation!"
+V,      solutionFileBuffer,         , 	             ,     std::vector<char>,,                   ,    ,    "write buffer of solution file, size according to solutionSettings.outputBufferSize; must exist until solutionFile is closed"
+V,      sensorFileBufferList,       , 	             ,     std::vector<std::vector<char>>,,      ,    ,    "write buffers of sensor files, corresponding to sensorFileList; must exist until sensor files are closed"
 #
 #F,      InitializeData,             ,                ,     void,         "*this = SolverOutputData();",,P, "initialize SolverOutputData by assigning default values"
 #